@@ -37,7 +37,8 @@
 
 #include "driver_max30205_basic.h"
 
-static max30205_handle_t gs_handle;        /**< max30205 handle */
+static max30205_handle_t gs_handle;          /**< max30205 handle */
+static max30205_periodic_t gs_periodic;      /**< max30205 periodic sampler */
 
 /**
  * @brief     basic example init
@@ -61,6 +62,7 @@ uint8_t max30205_basic_init(max30205_address_t addr_pin)
     DRIVER_MAX30205_LINK_IIC_WRITE(&gs_handle, max30205_interface_iic_write);
     DRIVER_MAX30205_LINK_DELAY_MS(&gs_handle, max30205_interface_delay_ms);
     DRIVER_MAX30205_LINK_DEBUG_PRINT(&gs_handle, max30205_interface_debug_print);
+    DRIVER_MAX30205_LINK_TIMESTAMP_US(&gs_handle, max30205_interface_timestamp_us);
     
     /* set max30205 iic address */
     res = max30205_set_addr_pin(&gs_handle, addr_pin);
@@ -180,6 +182,18 @@ uint8_t max30205_basic_init(max30205_address_t addr_pin)
         return 1;
     }
     
+    /* periodic sampler init */
+    DRIVER_MAX30205_PERIODIC_LINK_INIT(&gs_periodic, max30205_periodic_t);
+    DRIVER_MAX30205_PERIODIC_LINK_SLEEP_UNTIL_US(&gs_periodic, max30205_interface_sleep_until_us);
+    res = max30205_periodic_init(&gs_periodic, &gs_handle, max30205_continuous_read, MAX30205_BASIC_DEFAULT_PERIOD_US);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: periodic init failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
     return 0;
 }
 
@@ -206,6 +220,51 @@ uint8_t max30205_basic_read(float *s)
     }
 }
 
+/**
+ * @brief      basic example periodic read
+ * @param[out] *s pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it waits for the next absolute deadline of MAX30205_BASIC_DEFAULT_PERIOD_US and reads
+ */
+uint8_t max30205_basic_periodic_read(float *s)
+{
+    int16_t raw;
+    uint64_t timestamp_us;
+    
+    /* wait and read */
+    if (max30205_periodic_read(&gs_periodic, (int16_t *)&raw, s, &timestamp_us) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      basic example periodic statistics
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get statistics failed
+ * @note       none
+ */
+uint8_t max30205_basic_periodic_stats(max30205_periodic_stats_t *stats)
+{
+    /* get statistics */
+    if (max30205_periodic_get_stats(&gs_periodic, stats) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
 /**
  * @brief  basic example deinit
  * @return status code
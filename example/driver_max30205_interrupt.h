@@ -39,6 +39,7 @@
 #define DRIVER_MAX30205_INTERRUPT_H
 
 #include "driver_max30205_interface.h"
+#include "driver_max30205_periodic.h"
 
 #ifdef __cplusplus
 extern "C"{
@@ -56,6 +57,7 @@ extern "C"{
 #define MAX30205_INTERRUPT_DEFAULT_FAULT_QUEUE                MAX30205_FAULT_QUEUE_2                    /**< fault queue 2 */
 #define MAX30205_INTERRUPT_DEFAULT_PIN_POLARITY               MAX30205_PIN_POLARITY_LOW                 /**< polarity low */
 #define MAX30205_INTERRUPT_DEFAULT_BUS_TIMEOUT                MAX30205_BUS_TIMEOUT_DISABLE              /**< disable bus timeout */
+#define MAX30205_INTERRUPT_DEFAULT_PERIOD_US                  1000000                                   /**< 1 s sampling period */
 
 /**
  * @brief     interrupt example init
@@ -89,6 +91,26 @@ uint8_t max30205_interrupt_deinit(void);
  */
 uint8_t max30205_interrupt_read(float *s);
 
+/**
+ * @brief      interrupt example periodic read
+ * @param[out] *s pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it waits for the next absolute deadline of MAX30205_INTERRUPT_DEFAULT_PERIOD_US and reads
+ */
+uint8_t max30205_interrupt_periodic_read(float *s);
+
+/**
+ * @brief      interrupt example periodic statistics
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get statistics failed
+ * @note       none
+ */
+uint8_t max30205_interrupt_periodic_stats(max30205_periodic_stats_t *stats);
+
 /**
  * @}
  */
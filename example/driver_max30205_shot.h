@@ -39,6 +39,7 @@
 #define DRIVER_MAX30205_SHOT_H
 
 #include "driver_max30205_interface.h"
+#include "driver_max30205_periodic.h"
 
 #ifdef __cplusplus
 extern "C"{
@@ -59,6 +60,7 @@ extern "C"{
 #define MAX30205_SHOT_DEFAULT_BUS_TIMEOUT                MAX30205_BUS_TIMEOUT_DISABLE              /**< disable bus timeout */
 #define MAX30205_SHOT_DEFAULT_INTERRUPT_LOW_THRESHOLD    35.0f                                     /**< 35.0 low threshold interrupt */
 #define MAX30205_SHOT_DEFAULT_INTERRUPT_HIGH_THRESHOLD   39.0f                                     /**< 39.0 high threshold interrupt */
+#define MAX30205_SHOT_DEFAULT_PERIOD_US                  1000000                                   /**< 1 s sampling period */
 
 /**
  * @brief     shot example init
@@ -89,6 +91,26 @@ uint8_t max30205_shot_deinit(void);
  */
 uint8_t max30205_shot_read(float *s);
 
+/**
+ * @brief      shot example periodic read
+ * @param[out] *s pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it waits for the next absolute deadline of MAX30205_SHOT_DEFAULT_PERIOD_US and reads
+ */
+uint8_t max30205_shot_periodic_read(float *s);
+
+/**
+ * @brief      shot example periodic statistics
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get statistics failed
+ * @note       none
+ */
+uint8_t max30205_shot_periodic_stats(max30205_periodic_stats_t *stats);
+
 /**
  * @}
  */
@@ -39,6 +39,7 @@
 #define DRIVER_MAX30205_INTERFACE_H
 
 #include "driver_max30205.h"
+#include "driver_max30205_async.h"
 
 #ifdef __cplusplus
 extern "C"{
@@ -109,6 +110,99 @@ void max30205_interface_delay_ms(uint32_t ms);
  */
 void max30205_interface_debug_print(const char *const fmt, ...);
 
+/**
+ * @brief  interface timestamp us
+ * @return monotonic time in microseconds
+ * @note   it is optional, the template default counts the time spent in max30205_interface_delay_ms
+ */
+uint64_t max30205_interface_timestamp_us(void);
+
+/**
+ * @brief     interface sleep until
+ * @param[in] deadline_us absolute time on the max30205_interface_timestamp_us clock
+ * @note      it returns at once when the deadline has passed
+ */
+void max30205_interface_sleep_until_us(uint64_t deadline_us);
+
+/**
+ * @brief      interface iic bus read with a timeout
+ * @param[in]  *ctx pointer to a bus context
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  timeout_us time after which the read gives up
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it is the iic_read hook of the deadline reader, a port that cannot bound the transfer,
+ *             such as the stm32f407 bit-banged bus, ignores timeout_us and the deadline reader only
+ *             drops the late result
+ */
+uint8_t max30205_interface_iic_read_timeout(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf,
+                                            uint16_t len, uint32_t timeout_us);
+
+/**
+ * @brief     interface iic bus write with a timeout
+ * @param[in] *ctx pointer to a bus context
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @param[in] timeout_us time after which the write gives up
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      it is the iic_write hook of the deadline reader, a port that cannot bound the transfer,
+ *            such as the stm32f407 bit-banged bus, ignores timeout_us and the deadline reader only
+ *            drops the late result
+ */
+uint8_t max30205_interface_iic_write_timeout(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf,
+                                             uint16_t len, uint32_t timeout_us);
+
+/**
+ * @brief      interface non-blocking iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  *request pointer to the max30205 async request that owns the transfer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it is the iic_read hook of the async driver, it queues the transfer and its completion
+ *             calls max30205_async_complete, a blocking port may transfer and complete before returning
+ */
+uint8_t max30205_interface_iic_read_async(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                                          max30205_async_request_t *request);
+
+/**
+ * @brief     interface non-blocking iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @param[in] *request pointer to the max30205 async request that owns the transfer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      it is the iic_write hook of the async driver, it queues the transfer and its completion
+ *            calls max30205_async_complete, a blocking port may transfer and complete before returning
+ */
+uint8_t max30205_interface_iic_write_async(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                                           max30205_async_request_t *request);
+
+/**
+ * @brief     interface one-shot timer start
+ * @param[in] ms timer period
+ * @param[in] *request pointer to the max30205 async request that owns the timer
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      it is the timer_start hook of the async driver, the timer expiry calls max30205_async_complete
+ */
+uint8_t max30205_interface_timer_start(uint32_t ms, max30205_async_request_t *request);
+
 /**
  * @}
  */
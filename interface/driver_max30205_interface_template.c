@@ -37,6 +37,11 @@
 
 #include "driver_max30205_interface.h"
 
+/**
+ * @brief default timestamp definition
+ */
+static uint64_t gs_timestamp_us = 0;        /**< time spent in delay ms */
+
 /**
  * @brief  interface iic bus init
  * @return status code
@@ -100,7 +105,8 @@ uint8_t max30205_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, ui
  */
 void max30205_interface_delay_ms(uint32_t ms)
 {
-
+    /* advance the default timestamp clock */
+    gs_timestamp_us += (uint64_t)ms * 1000;
 }
 
 /**
@@ -112,3 +118,130 @@ void max30205_interface_debug_print(const char *const fmt, ...)
 {
     
 }
+
+/**
+ * @brief  interface timestamp us
+ * @return monotonic time in microseconds
+ * @note   it is optional, this default only counts the time spent in max30205_interface_delay_ms,
+ *         so the periodic sampler still paces itself but reports no bus jitter, replace it with a
+ *         free running hardware counter to get real jitter and overrun statistics
+ */
+uint64_t max30205_interface_timestamp_us(void)
+{
+    return gs_timestamp_us;
+}
+
+/**
+ * @brief     interface sleep until
+ * @param[in] deadline_us absolute time on the max30205_interface_timestamp_us clock
+ * @note      it returns at once when the deadline has passed, this fallback sleeps the rest with
+ *            max30205_interface_delay_ms and should be replaced by an absolute timer sleep
+ */
+void max30205_interface_sleep_until_us(uint64_t deadline_us)
+{
+    uint64_t now;
+    
+    now = max30205_interface_timestamp_us();
+    if (deadline_us > now)
+    {
+        max30205_interface_delay_ms((uint32_t)((deadline_us - now + 999) / 1000));
+    }
+}
+
+/**
+ * @brief      interface iic bus read with a timeout
+ * @param[in]  *ctx pointer to a bus context
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  timeout_us time after which the read gives up
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t max30205_interface_iic_read_timeout(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf,
+                                            uint16_t len, uint32_t timeout_us)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface iic bus write with a timeout
+ * @param[in] *ctx pointer to a bus context
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @param[in] timeout_us time after which the write gives up
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t max30205_interface_iic_write_timeout(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf,
+                                             uint16_t len, uint32_t timeout_us)
+{
+    return 0;
+}
+
+/**
+ * @brief      interface non-blocking iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  *request pointer to the max30205 async request that owns the transfer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       this default reads blocking and completes before returning, a port with dma or an
+ *             interrupt driven bus queues the transfer and calls max30205_async_complete from its completion
+ */
+uint8_t max30205_interface_iic_read_async(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                                          max30205_async_request_t *request)
+{
+    (void)max30205_async_complete(request, max30205_interface_iic_read(addr, reg, buf, len));
+    
+    return 0;
+}
+
+/**
+ * @brief     interface non-blocking iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @param[in] *request pointer to the max30205 async request that owns the transfer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      this default writes blocking and completes before returning, a port with dma or an
+ *            interrupt driven bus queues the transfer and calls max30205_async_complete from its completion
+ */
+uint8_t max30205_interface_iic_write_async(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                                           max30205_async_request_t *request)
+{
+    (void)max30205_async_complete(request, max30205_interface_iic_write(addr, reg, buf, len));
+    
+    return 0;
+}
+
+/**
+ * @brief     interface one-shot timer start
+ * @param[in] ms timer period
+ * @param[in] *request pointer to the max30205 async request that owns the timer
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      this default waits with max30205_interface_delay_ms, a port with a hardware timer
+ *            calls max30205_async_complete from the timer interrupt
+ */
+uint8_t max30205_interface_timer_start(uint32_t ms, max30205_async_request_t *request)
+{
+    max30205_interface_delay_ms(ms);
+    (void)max30205_async_complete(request, 0);
+    
+    return 0;
+}
@@ -0,0 +1,292 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_max30205_acquire.h
+ * @brief     raspberrypi4b driver max30205 acquire header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_MAX30205_ACQUIRE_H
+#define RASPBERRYPI4B_DRIVER_MAX30205_ACQUIRE_H
+
+#include "driver_max30205.h"
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup raspberrypi4b_driver_max30205_acquire
+ * @{
+ */
+
+/**
+ * @brief acquire capacity definition
+ */
+#ifndef MAX30205_ACQUIRE_BUS_MAX
+    #define MAX30205_ACQUIRE_BUS_MAX      8          /**< max buses, one worker thread each */
+#endif
+#ifndef MAX30205_ACQUIRE_QUEUE_MAX
+    #define MAX30205_ACQUIRE_QUEUE_MAX    256        /**< max queued samples per bus */
+#endif
+#ifndef MAX30205_ACQUIRE_LATENCY_MAX
+    #define MAX30205_ACQUIRE_LATENCY_MAX  4096       /**< latency histogram buckets of 1 us, the last one holds the overflow */
+#endif
+#ifndef MAX30205_ACQUIRE_PREFAULT
+    #define MAX30205_ACQUIRE_PREFAULT     65536      /**< worker stack bytes touched before the loop in real-time mode */
+#endif
+
+/**
+ * @brief max30205 acquire sample structure definition
+ */
+typedef struct max30205_acquire_sample_s
+{
+    uint64_t timestamp_us;        /**< CLOCK_MONOTONIC time when the read completed */
+    float s;                      /**< converted temperature */
+    int16_t raw;                  /**< raw data */
+    uint8_t bus;                  /**< bus index */
+    uint8_t index;                /**< sensor index on the bus */
+    uint8_t res;                  /**< max30205_continuous_read result */
+} max30205_acquire_sample_t;
+
+/**
+ * @brief max30205 acquire latency structure definition
+ */
+typedef struct max30205_acquire_latency_s
+{
+    uint64_t cycles;         /**< measured sweeps */
+    uint32_t p50_us;         /**< median cycle latency */
+    uint32_t p99_us;         /**< 99th percentile cycle latency */
+    uint32_t p999_us;        /**< 99.9th percentile cycle latency */
+    uint32_t max_us;         /**< worst cycle latency */
+} max30205_acquire_latency_t;
+
+/**
+ * @brief max30205 acquire worker structure definition
+ */
+typedef struct max30205_acquire_worker_s
+{
+    struct max30205_acquire_s *acquire;                                    /**< owner runtime */
+    max30205_handle_t **handle;                                            /**< sensors on the bus */
+    uint8_t num;                                                           /**< sensor number */
+    uint8_t id;                                                            /**< bus index */
+    int cpu;                                                               /**< pinned cpu, -1 for none */
+    uint32_t period_us;                                                    /**< sweep period, 0 for free running */
+    pthread_t thread;                                                      /**< worker thread */
+    pthread_mutex_t mutex;                                                 /**< queue lock */
+    max30205_acquire_sample_t queue[MAX30205_ACQUIRE_QUEUE_MAX];           /**< samples waiting for post-processing */
+    uint16_t head;                                                         /**< queue head */
+    uint16_t count;                                                        /**< queue count */
+    uint64_t floor_us;                                                     /**< no later sample of this bus is older */
+    uint64_t inflight_us;                                                  /**< sample this worker is processing */
+    uint64_t samples;                                                      /**< samples read on this bus */
+    uint64_t processed;                                                    /**< samples processed by this worker */
+    uint64_t stolen;                                                       /**< samples stolen from other buses */
+    uint32_t latency[MAX30205_ACQUIRE_LATENCY_MAX];                        /**< cycle latency histogram */
+    uint32_t latency_max_us;                                               /**< worst cycle latency */
+    uint64_t cycles;                                                       /**< measured sweeps */
+} max30205_acquire_worker_t;
+
+/**
+ * @brief max30205 acquire structure definition
+ */
+typedef struct max30205_acquire_s
+{
+    void (*process)(max30205_acquire_sample_t *sample, void *user);                /**< post-processing, runs on any worker */
+    void (*sink)(const max30205_acquire_sample_t *sample, void *user);             /**< merged stream, called in time order */
+    void *user;                                                                    /**< user data */
+    max30205_acquire_worker_t worker[MAX30205_ACQUIRE_BUS_MAX];                    /**< bus workers */
+    uint8_t num;                                                                   /**< bus number */
+    uint8_t running;                                                               /**< running flag */
+    uint8_t locked;                                                                /**< memory locked flag */
+    int priority;                                                                  /**< SCHED_FIFO priority of the workers, 0 for the default policy */
+    pthread_mutex_t mutex;                                                         /**< merge lock */
+    max30205_acquire_sample_t heap[MAX30205_ACQUIRE_BUS_MAX * MAX30205_ACQUIRE_QUEUE_MAX];   /**< processed samples ordered by time */
+    uint32_t heap_len;                                                             /**< heap length */
+    uint64_t emitted;                                                              /**< samples passed to the sink */
+    uint64_t late;                                                                 /**< samples forced out of order by a full heap */
+} max30205_acquire_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup raspberrypi4b_driver_max30205_acquire raspberrypi4b driver max30205 acquire function
+ * @brief    raspberrypi4b driver max30205 acquire modules
+ * @ingroup  max30205_driver
+ * @{
+ */
+
+/**
+ * @brief     init the acquisition runtime
+ * @param[in] *acquire pointer to a max30205 acquire structure
+ * @param[in] *process pointer to a post-processing function, it can be NULL
+ * @param[in] *sink pointer to a merged stream function
+ * @param[in] *user pointer to user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 handle is NULL
+ * @note      the structure is large, allocate it statically or on the heap
+ */
+uint8_t max30205_acquire_init(max30205_acquire_t *acquire,
+                              void (*process)(max30205_acquire_sample_t *sample, void *user),
+                              void (*sink)(const max30205_acquire_sample_t *sample, void *user),
+                              void *user);
+
+/**
+ * @brief     deinit the acquisition runtime
+ * @param[in] *acquire pointer to a max30205 acquire structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ *            - 2 handle is NULL
+ *            - 4 runtime is running
+ * @note      none
+ */
+uint8_t max30205_acquire_deinit(max30205_acquire_t *acquire);
+
+/**
+ * @brief     add a bus
+ * @param[in] *acquire pointer to a max30205 acquire structure
+ * @param[in] **handle pointer to an array of initialized and started handles on one bus
+ * @param[in] num array length
+ * @param[in] cpu cpu to pin the bus worker on, -1 for none
+ * @param[in] period_us sweep period, 0 for free running sweeps
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ *            - 2 handle is NULL
+ *            - 4 runtime is running
+ *            - 5 too many buses or sensors
+ * @note      the worker is the only thread touching these handles while the runtime is running
+ */
+uint8_t max30205_acquire_add_bus(max30205_acquire_t *acquire, max30205_handle_t **handle, uint8_t num,
+                                 int cpu, uint32_t period_us);
+
+/**
+ * @brief     set the real-time mode
+ * @param[in] *acquire pointer to a max30205 acquire structure
+ * @param[in] priority SCHED_FIFO priority of the bus workers, 0 for the default policy
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 runtime is running
+ *            - 5 priority is invalid
+ * @note      in real-time mode start locks the process memory, pre-faults the buffers and the worker stacks,
+ *            the process and sink functions run on the workers and must not allocate, print or block either
+ */
+uint8_t max30205_acquire_set_realtime(max30205_acquire_t *acquire, int priority);
+
+/**
+ * @brief     start the bus workers
+ * @param[in] *acquire pointer to a max30205 acquire structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ *            - 2 handle is NULL
+ *            - 4 runtime is running
+ *            - 5 real-time setup failed
+ * @note      the latency histograms restart from zero,
+ *            real-time mode needs CAP_SYS_NICE and CAP_IPC_LOCK or a matching rlimit
+ */
+uint8_t max30205_acquire_start(max30205_acquire_t *acquire);
+
+/**
+ * @brief     stop the bus workers
+ * @param[in] *acquire pointer to a max30205 acquire structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 runtime is not running
+ * @note      the queued samples are processed and flushed to the sink before it returns
+ */
+uint8_t max30205_acquire_stop(max30205_acquire_t *acquire);
+
+/**
+ * @brief      get the bus statistics
+ * @param[in]  *acquire pointer to a max30205 acquire structure
+ * @param[in]  bus bus index
+ * @param[out] *samples pointer to a read samples buffer
+ * @param[out] *processed pointer to a processed samples buffer
+ * @param[out] *stolen pointer to a stolen samples buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 5 bus is invalid
+ * @note       processed and stolen count the work done by the bus worker for any bus
+ */
+uint8_t max30205_acquire_get_stats(max30205_acquire_t *acquire, uint8_t bus,
+                                   uint64_t *samples, uint64_t *processed, uint64_t *stolen);
+
+/**
+ * @brief      get the cycle latency of a bus
+ * @param[in]  *acquire pointer to a max30205 acquire structure
+ * @param[in]  bus bus index
+ * @param[out] *latency pointer to a max30205 acquire latency structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 5 bus is invalid
+ * @note       the cycle latency runs from the scheduled sweep start to the end of the sweep,
+ *             a free running bus schedules every sweep at the time it begins
+ */
+uint8_t max30205_acquire_get_latency(max30205_acquire_t *acquire, uint8_t bus, max30205_acquire_latency_t *latency);
+
+/**
+ * @brief      run the jitter benchmark
+ * @param[in]  *handle pointer to an initialized and started max30205 handle
+ * @param[in]  period_us sweep period, 0 for free running sweeps
+ * @param[in]  cycles measured sweeps
+ * @param[in]  priority SCHED_FIFO priority, 0 for the default policy
+ * @param[in]  cpu cpu to pin the worker on, -1 for none
+ * @param[out] *latency pointer to a max30205 acquire latency structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ *             - 2 handle is NULL
+ *             - 5 real-time setup failed or priority is invalid
+ * @note       it runs one bus worker on a static runtime, so it is not reentrant
+ */
+uint8_t max30205_acquire_benchmark(max30205_handle_t *handle, uint32_t period_us, uint32_t cycles,
+                                   int priority, int cpu, max30205_acquire_latency_t *latency);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
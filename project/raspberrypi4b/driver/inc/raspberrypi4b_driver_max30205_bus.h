@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_max30205_bus.h
+ * @brief     raspberrypi4b driver max30205 bus header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_MAX30205_BUS_H
+#define RASPBERRYPI4B_DRIVER_MAX30205_BUS_H
+
+#include "driver_max30205.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup raspberrypi4b_driver_max30205_bus raspberrypi4b driver max30205 bus function
+ * @brief    raspberrypi4b driver max30205 bus modules
+ * @ingroup  max30205_driver
+ * @{
+ */
+
+/**
+ * @brief linux iic bus structure definition
+ */
+typedef struct max30205_linux_bus_s
+{
+    char name[32];              /**< iic device name */
+    int fd;                     /**< iic handle */
+    uint32_t refs;              /**< opened handles */
+    max30205_bus_t bus;         /**< driver bus */
+} max30205_linux_bus_t;
+
+/**
+ * @brief     bind a linux iic bus
+ * @param[in] *linux_bus pointer to a linux iic bus structure
+ * @param[in] num iic adapter number of /dev/i2c-N
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      it only fills the structure, the adapter is opened by the first max30205_init on
+ *            the bus and closed by the last max30205_deinit, init and deinit the handles of one
+ *            bus from one thread
+ */
+uint8_t max30205_linux_bus_bind(max30205_linux_bus_t *linux_bus, uint8_t num);
+
+/**
+ * @brief     get the driver bus of a linux iic bus
+ * @param[in] *linux_bus pointer to a linux iic bus structure
+ * @return    pointer to the driver bus to link with DRIVER_MAX30205_LINK_BUS
+ * @note      it needs MAX30205_CONFIG_SHARED_OPS set to 1 to be linked to a handle
+ */
+const max30205_bus_t *max30205_linux_bus_get(max30205_linux_bus_t *linux_bus);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,206 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_max30205_reactor.hpp
+ * @brief     raspberrypi4b driver max30205 reactor header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_MAX30205_REACTOR_HPP
+#define RASPBERRYPI4B_DRIVER_MAX30205_REACTOR_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+
+#include "driver_max30205_coroutine.hpp"
+
+/**
+ * @defgroup raspberrypi4b_driver_max30205_reactor raspberrypi4b driver max30205 reactor function
+ * @brief    raspberrypi4b driver max30205 reactor modules
+ * @ingroup  max30205_driver
+ * @{
+ */
+
+namespace max30205
+{
+
+/**
+ * @brief max30205 reactor
+ * @note  the async worker of the interface posts the completions, run() resumes every
+ *        coroutine on the calling thread and fires the timers on the steady clock
+ */
+class reactor final : public executor
+{
+    public:
+        using clock = std::chrono::steady_clock;
+        
+        /**
+         * @brief max30205 reactor timer awaiter
+         */
+        class timer
+        {
+            public:
+                timer(reactor &r, clock::time_point due) noexcept : m_reactor(&r), m_due(due) {}
+                
+                bool await_ready() const noexcept
+                {
+                    return m_due <= clock::now();
+                }
+                
+                void await_suspend(std::coroutine_handle<> h)
+                {
+                    m_reactor->a_add_timer(m_due, h);
+                }
+                
+                void await_resume() const noexcept {}
+                
+            private:
+                reactor *m_reactor;
+                clock::time_point m_due;
+        };
+        
+        reactor() = default;
+        reactor(const reactor &) = delete;
+        reactor &operator=(const reactor &) = delete;
+        
+        /**
+         * @brief     schedule a coroutine
+         * @param[in] h coroutine to resume
+         * @note      it is thread safe and only queues, the coroutine resumes inside run()
+         */
+        void post(std::coroutine_handle<> h) override
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            
+            m_ready.push_back(h);
+            m_cond.notify_one();
+        }
+        
+        /**
+         * @brief     await a relative time
+         * @param[in] d time to sleep
+         * @return    awaitable timer
+         * @note      the bus stays free for the other coroutines while sleeping
+         */
+        timer sleep_for(clock::duration d) noexcept
+        {
+            return timer(*this, clock::now() + d);
+        }
+        
+        /**
+         * @brief     await an absolute time
+         * @param[in] due time to wake up
+         * @return    awaitable timer
+         * @note      none
+         */
+        timer sleep_until(clock::time_point due) noexcept
+        {
+            return timer(*this, due);
+        }
+        
+        /**
+         * @brief     run a top level task to its end
+         * @param[in] t reference to an unstarted task
+         * @return    reference to the task result
+         * @note      it starts the task on the calling thread and returns once it has finished
+         */
+        template <typename T>
+        T &run(task<T> &t)
+        {
+            t.start();
+            while (!t.done())
+            {
+                a_run_once();
+            }
+            
+            return t.get();
+        }
+        
+    private:
+        void a_add_timer(clock::time_point due, std::coroutine_handle<> h)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            
+            m_timers.emplace(due, h);
+        }
+        
+        void a_run_once()
+        {
+            std::deque<std::coroutine_handle<>> batch;
+            
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                
+                /* wait for a completion or the earliest timer */
+                while (m_ready.empty())
+                {
+                    if (m_timers.empty())
+                    {
+                        m_cond.wait(lock);
+                    }
+                    else if (m_cond.wait_until(lock, m_timers.begin()->first) == std::cv_status::timeout)
+                    {
+                        break;
+                    }
+                }
+                
+                /* due timers run after the completions already queued */
+                while (!m_timers.empty() && (m_timers.begin()->first <= clock::now()))
+                {
+                    m_ready.push_back(m_timers.begin()->second);
+                    m_timers.erase(m_timers.begin());
+                }
+                batch.swap(m_ready);
+            }
+            
+            /* resume outside the lock, a resumed coroutine may post or add a timer */
+            for (std::coroutine_handle<> h : batch)
+            {
+                h.resume();
+            }
+        }
+        
+        std::mutex m_mutex;
+        std::condition_variable m_cond;
+        std::deque<std::coroutine_handle<>> m_ready;
+        std::multimap<clock::time_point, std::coroutine_handle<>> m_timers;
+};
+
+}
+
+/**
+ * @}
+ */
+
+#endif
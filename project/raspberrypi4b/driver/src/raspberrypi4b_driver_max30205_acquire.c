@@ -0,0 +1,967 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_max30205_acquire.c
+ * @brief     raspberrypi4b driver max30205 acquire source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _GNU_SOURCE
+#include "raspberrypi4b_driver_max30205_acquire.h"
+#include <sched.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief no time definition
+ */
+#define MAX30205_ACQUIRE_NEVER    0xFFFFFFFFFFFFFFFFULL        /**< no sample pending */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in us
+ * @note   none
+ */
+static uint64_t a_acquire_now_us(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL;
+}
+
+/**
+ * @brief     push a processed sample to the heap
+ * @param[in] *acquire pointer to a max30205 acquire structure
+ * @param[in] *sample pointer to a sample
+ * @note      the merge lock must be held
+ */
+static void a_acquire_heap_push(max30205_acquire_t *acquire, const max30205_acquire_sample_t *sample)
+{
+    uint32_t i;
+    
+    /* sift up */
+    i = acquire->heap_len++;
+    while (i > 0)
+    {
+        uint32_t parent = (i - 1) / 2;
+        
+        if (acquire->heap[parent].timestamp_us <= sample->timestamp_us)
+        {
+            break;
+        }
+        acquire->heap[i] = acquire->heap[parent];
+        i = parent;
+    }
+    acquire->heap[i] = *sample;
+}
+
+/**
+ * @brief     pop the oldest sample and pass it to the sink
+ * @param[in] *acquire pointer to a max30205 acquire structure
+ * @note      the merge lock must be held
+ */
+static void a_acquire_heap_emit(max30205_acquire_t *acquire)
+{
+    max30205_acquire_sample_t last;
+    uint32_t i;
+    
+    acquire->sink(&acquire->heap[0], acquire->user);
+    acquire->emitted++;
+    
+    /* sift down */
+    last = acquire->heap[--acquire->heap_len];
+    i = 0;
+    while (1)
+    {
+        uint32_t c = 2 * i + 1;
+        
+        if (c >= acquire->heap_len)
+        {
+            break;
+        }
+        if ((c + 1 < acquire->heap_len) && (acquire->heap[c + 1].timestamp_us < acquire->heap[c].timestamp_us))
+        {
+            c++;
+        }
+        if (last.timestamp_us <= acquire->heap[c].timestamp_us)
+        {
+            break;
+        }
+        acquire->heap[i] = acquire->heap[c];
+        i = c;
+    }
+    if (acquire->heap_len > 0)
+    {
+        acquire->heap[i] = last;
+    }
+}
+
+/**
+ * @brief     emit every sample no unprocessed sample can precede
+ * @param[in] *acquire pointer to a max30205 acquire structure
+ * @note      the merge lock must be held, it takes the queue locks in bus order
+ */
+static void a_acquire_merge(max30205_acquire_t *acquire)
+{
+    uint64_t horizon;
+    uint8_t i;
+    
+    /* the oldest sample still queued, in flight or not read yet */
+    horizon = MAX30205_ACQUIRE_NEVER;
+    for (i = 0; i < acquire->num; i++)
+    {
+        (void)pthread_mutex_lock(&acquire->worker[i].mutex);
+    }
+    for (i = 0; i < acquire->num; i++)
+    {
+        max30205_acquire_worker_t *w = &acquire->worker[i];
+        uint64_t t;
+        
+        t = (w->count != 0) ? w->queue[w->head].timestamp_us : w->floor_us;
+        if (t < horizon)
+        {
+            horizon = t;
+        }
+        if (w->inflight_us < horizon)
+        {
+            horizon = w->inflight_us;
+        }
+    }
+    for (i = acquire->num; i > 0; i--)
+    {
+        (void)pthread_mutex_unlock(&acquire->worker[i - 1].mutex);
+    }
+    
+    /* emit in time order */
+    while ((acquire->heap_len > 0) && (acquire->heap[0].timestamp_us <= horizon))
+    {
+        a_acquire_heap_emit(acquire);
+    }
+}
+
+/**
+ * @brief      init a runtime mutex
+ * @param[out] *mutex pointer to a mutex
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       priority inheritance keeps a real-time worker from waiting on a preempted lock holder
+ */
+static uint8_t a_acquire_mutex_init(pthread_mutex_t *mutex)
+{
+    pthread_mutexattr_t attr;
+    uint8_t res = 0;
+    
+    if (pthread_mutexattr_init(&attr) != 0)
+    {
+        return 1;
+    }
+    (void)pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT);
+    if (pthread_mutex_init(mutex, &attr) != 0)
+    {
+        res = 1;
+    }
+    (void)pthread_mutexattr_destroy(&attr);
+    
+    return res;
+}
+
+/**
+ * @brief     record a cycle latency
+ * @param[in] *w pointer to a worker
+ * @param[in] latency_us cycle latency
+ * @note      none
+ */
+static void a_acquire_record(max30205_acquire_worker_t *w, uint64_t latency_us)
+{
+    if (latency_us > w->latency_max_us)
+    {
+        w->latency_max_us = (latency_us > 0xFFFFFFFFULL) ? 0xFFFFFFFFU : (uint32_t)latency_us;
+    }
+    if (latency_us >= MAX30205_ACQUIRE_LATENCY_MAX)
+    {
+        latency_us = MAX30205_ACQUIRE_LATENCY_MAX - 1;
+    }
+    w->latency[latency_us]++;
+    __atomic_store_n(&w->cycles, w->cycles + 1, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief  touch the worker stack
+ * @note   the pages are faulted in once so the loop never takes a page fault on its stack
+ */
+static void a_acquire_prefault_stack(void)
+{
+    volatile uint8_t stack[MAX30205_ACQUIRE_PREFAULT];
+    uint32_t i;
+    
+    for (i = 0; i < MAX30205_ACQUIRE_PREFAULT; i += 4096)
+    {
+        stack[i] = 0;
+    }
+    (void)stack[0];
+}
+
+/**
+ * @brief     unlock the process memory locked by a real-time start
+ * @param[in] *acquire pointer to a max30205 acquire structure
+ * @note      none
+ */
+static void a_acquire_unlock(max30205_acquire_t *acquire)
+{
+    if (acquire->locked != 0)
+    {
+        (void)munlockall();
+        acquire->locked = 0;
+    }
+}
+
+/**
+ * @brief     post-process a sample and merge it
+ * @param[in] *w pointer to the worker doing the work
+ * @param[in] *sample pointer to a sample taken by this worker
+ * @note      none
+ */
+static void a_acquire_process(max30205_acquire_worker_t *w, max30205_acquire_sample_t *sample)
+{
+    max30205_acquire_t *acquire = w->acquire;
+    
+    /* conversion, filtering and encoding run outside every lock */
+    if (acquire->process != NULL)
+    {
+        acquire->process(sample, acquire->user);
+    }
+    w->processed++;
+    
+    /* merge */
+    (void)pthread_mutex_lock(&acquire->mutex);
+    if (acquire->heap_len >= MAX30205_ACQUIRE_BUS_MAX * MAX30205_ACQUIRE_QUEUE_MAX)
+    {
+        a_acquire_heap_emit(acquire);
+        acquire->late++;
+    }
+    a_acquire_heap_push(acquire, sample);
+    w->inflight_us = MAX30205_ACQUIRE_NEVER;
+    a_acquire_merge(acquire);
+    (void)pthread_mutex_unlock(&acquire->mutex);
+}
+
+/**
+ * @brief      take the oldest queued sample of a bus
+ * @param[in]  *w pointer to the worker doing the work
+ * @param[in]  *victim pointer to the worker owning the queue
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 queue is empty
+ * @note       the sample is marked in flight under the queue lock so the merge never loses it
+ */
+static uint8_t a_acquire_take(max30205_acquire_worker_t *w, max30205_acquire_worker_t *victim,
+                              max30205_acquire_sample_t *sample)
+{
+    uint8_t res = 1;
+    
+    (void)pthread_mutex_lock(&victim->mutex);
+    if (victim->count != 0)
+    {
+        *sample = victim->queue[victim->head];
+        victim->head = (uint16_t)((victim->head + 1) % MAX30205_ACQUIRE_QUEUE_MAX);
+        __atomic_store_n(&victim->count, (uint16_t)(victim->count - 1), __ATOMIC_RELAXED);
+        w->inflight_us = sample->timestamp_us;
+        res = 0;
+    }
+    (void)pthread_mutex_unlock(&victim->mutex);
+    
+    return res;
+}
+
+/**
+ * @brief      steal a sample from the busiest other bus
+ * @param[in]  *w pointer to the worker doing the work
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 nothing to steal
+ * @note       none
+ */
+static uint8_t a_acquire_steal(max30205_acquire_worker_t *w, max30205_acquire_sample_t *sample)
+{
+    max30205_acquire_t *acquire = w->acquire;
+    max30205_acquire_worker_t *victim = NULL;
+    uint16_t most = 0;
+    uint16_t count;
+    uint8_t i;
+    
+    /* the count read is a hint, take() checks it again under the lock */
+    for (i = 0; i < acquire->num; i++)
+    {
+        count = __atomic_load_n(&acquire->worker[i].count, __ATOMIC_RELAXED);
+        if ((&acquire->worker[i] != w) && (count > most))
+        {
+            most = count;
+            victim = &acquire->worker[i];
+        }
+    }
+    if ((victim == NULL) || (a_acquire_take(w, victim, sample) != 0))
+    {
+        return 1;
+    }
+    w->stolen++;
+    
+    return 0;
+}
+
+/**
+ * @brief     set the time no later sample of the bus can precede
+ * @param[in] *w pointer to a worker
+ * @note      none
+ */
+static void a_acquire_set_floor(max30205_acquire_worker_t *w)
+{
+    (void)pthread_mutex_lock(&w->mutex);
+    w->floor_us = a_acquire_now_us();
+    (void)pthread_mutex_unlock(&w->mutex);
+}
+
+/**
+ * @brief     read every sensor of the bus once
+ * @param[in] *w pointer to a worker
+ * @note      a full queue makes the bus worker process its oldest sample itself
+ */
+static void a_acquire_sweep(max30205_acquire_worker_t *w)
+{
+    max30205_acquire_sample_t sample;
+    max30205_acquire_sample_t old;
+    uint8_t full;
+    uint8_t i;
+    
+    for (i = 0; i < w->num; i++)
+    {
+        /* bus transaction */
+        a_acquire_set_floor(w);
+        memset(&sample, 0, sizeof(max30205_acquire_sample_t));
+        sample.res = max30205_continuous_read(w->handle[i], &sample.raw, &sample.s);
+        sample.timestamp_us = a_acquire_now_us();
+        sample.bus = w->id;
+        sample.index = i;
+        w->samples++;
+        
+        /* queue it, make room with the oldest one when full */
+        (void)pthread_mutex_lock(&w->mutex);
+        full = (w->count == MAX30205_ACQUIRE_QUEUE_MAX);
+        if (full != 0)
+        {
+            old = w->queue[w->head];
+            w->head = (uint16_t)((w->head + 1) % MAX30205_ACQUIRE_QUEUE_MAX);
+            __atomic_store_n(&w->count, (uint16_t)(w->count - 1), __ATOMIC_RELAXED);
+            w->inflight_us = old.timestamp_us;
+        }
+        w->queue[(w->head + w->count) % MAX30205_ACQUIRE_QUEUE_MAX] = sample;
+        __atomic_store_n(&w->count, (uint16_t)(w->count + 1), __ATOMIC_RELAXED);
+        (void)pthread_mutex_unlock(&w->mutex);
+        if (full != 0)
+        {
+            a_acquire_process(w, &old);
+        }
+    }
+}
+
+/**
+ * @brief     bus worker thread
+ * @param[in] *arg pointer to a worker
+ * @return    NULL
+ * @note      none
+ */
+static void *a_acquire_worker(void *arg)
+{
+    max30205_acquire_worker_t *w = (max30205_acquire_worker_t *)arg;
+    max30205_acquire_t *acquire = w->acquire;
+    max30205_acquire_sample_t sample;
+    struct timespec ts;
+    uint64_t start;
+    uint64_t next;
+    uint64_t now;
+    
+    /* real-time workers fault their stack in before the loop */
+    if (acquire->priority != 0)
+    {
+        a_acquire_prefault_stack();
+    }
+    
+    /* pin to the cpu */
+    if (w->cpu >= 0)
+    {
+        cpu_set_t set;
+        
+        CPU_ZERO(&set);
+        CPU_SET(w->cpu, &set);
+        (void)pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set);
+    }
+    
+    next = a_acquire_now_us();
+    while (__atomic_load_n(&acquire->running, __ATOMIC_ACQUIRE) != 0)
+    {
+        /* the bus comes first */
+        now = a_acquire_now_us();
+        if ((w->num != 0) && (now >= next))
+        {
+            start = (w->period_us != 0) ? next : now;
+            a_acquire_sweep(w);
+            a_acquire_record(w, a_acquire_now_us() - start);
+            if (w->period_us != 0)
+            {
+                next += w->period_us;
+                if (next < now)
+                {
+                    next = now + w->period_us;
+                }
+            }
+            else
+            {
+                next = now;
+                
+                /* free running buses keep half of the queue for the thieves */
+                if ((__atomic_load_n(&w->count, __ATOMIC_RELAXED) > MAX30205_ACQUIRE_QUEUE_MAX / 2) &&
+                    (a_acquire_take(w, w, &sample) == 0))
+                {
+                    a_acquire_process(w, &sample);
+                }
+            }
+            a_acquire_set_floor(w);
+            
+            continue;
+        }
+        
+        /* idle: own work first, then steal */
+        if ((a_acquire_take(w, w, &sample) == 0) || (a_acquire_steal(w, &sample) == 0))
+        {
+            a_acquire_process(w, &sample);
+            
+            continue;
+        }
+        
+        /* nothing to do, let the merged stream advance and wait for the next sweep */
+        a_acquire_set_floor(w);
+        (void)pthread_mutex_lock(&acquire->mutex);
+        a_acquire_merge(acquire);
+        (void)pthread_mutex_unlock(&acquire->mutex);
+        if ((w->num != 0) && (next > now) && ((next - now) < 200))
+        {
+            /* the last stretch sleeps to the absolute sweep time */
+            ts.tv_sec = (time_t)(next / 1000000ULL);
+            ts.tv_nsec = (long)((next % 1000000ULL) * 1000ULL);
+            (void)clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+        }
+        else
+        {
+            (void)usleep(200);
+        }
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     init the acquisition runtime
+ * @param[in] *acquire pointer to a max30205 acquire structure
+ * @param[in] *process pointer to a post-processing function, it can be NULL
+ * @param[in] *sink pointer to a merged stream function
+ * @param[in] *user pointer to user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 handle is NULL
+ * @note      the structure is large, allocate it statically or on the heap
+ */
+uint8_t max30205_acquire_init(max30205_acquire_t *acquire,
+                              void (*process)(max30205_acquire_sample_t *sample, void *user),
+                              void (*sink)(const max30205_acquire_sample_t *sample, void *user),
+                              void *user)
+{
+    if ((acquire == NULL) || (sink == NULL))
+    {
+        return 2;
+    }
+    
+    memset(acquire, 0, sizeof(max30205_acquire_t));
+    if (a_acquire_mutex_init(&acquire->mutex) != 0)
+    {
+        return 1;
+    }
+    acquire->process = process;
+    acquire->sink = sink;
+    acquire->user = user;
+    
+    return 0;
+}
+
+/**
+ * @brief     deinit the acquisition runtime
+ * @param[in] *acquire pointer to a max30205 acquire structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ *            - 2 handle is NULL
+ *            - 4 runtime is running
+ * @note      none
+ */
+uint8_t max30205_acquire_deinit(max30205_acquire_t *acquire)
+{
+    uint8_t res = 0;
+    uint8_t i;
+    
+    if (acquire == NULL)
+    {
+        return 2;
+    }
+    if (acquire->running != 0)
+    {
+        return 4;
+    }
+    
+    for (i = 0; i < acquire->num; i++)
+    {
+        if (pthread_mutex_destroy(&acquire->worker[i].mutex) != 0)
+        {
+            res = 1;
+        }
+    }
+    acquire->num = 0;
+    if (pthread_mutex_destroy(&acquire->mutex) != 0)
+    {
+        res = 1;
+    }
+    
+    return res;
+}
+
+/**
+ * @brief     add a bus
+ * @param[in] *acquire pointer to a max30205 acquire structure
+ * @param[in] **handle pointer to an array of initialized and started handles on one bus
+ * @param[in] num array length
+ * @param[in] cpu cpu to pin the bus worker on, -1 for none
+ * @param[in] period_us sweep period, 0 for free running sweeps
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ *            - 2 handle is NULL
+ *            - 4 runtime is running
+ *            - 5 too many buses or sensors
+ * @note      the worker is the only thread touching these handles while the runtime is running
+ */
+uint8_t max30205_acquire_add_bus(max30205_acquire_t *acquire, max30205_handle_t **handle, uint8_t num,
+                                 int cpu, uint32_t period_us)
+{
+    max30205_acquire_worker_t *w;
+    
+    if ((acquire == NULL) || ((handle == NULL) && (num != 0)))
+    {
+        return 2;
+    }
+    if (acquire->running != 0)
+    {
+        return 4;
+    }
+    if ((acquire->num >= MAX30205_ACQUIRE_BUS_MAX) || (num > MAX30205_CONFIG_GROUP_MAX))
+    {
+        return 5;
+    }
+    
+    w = &acquire->worker[acquire->num];
+    memset(w, 0, sizeof(max30205_acquire_worker_t));
+    if (a_acquire_mutex_init(&w->mutex) != 0)
+    {
+        return 1;
+    }
+    w->acquire = acquire;
+    w->handle = handle;
+    w->num = num;
+    w->id = acquire->num;
+    w->cpu = cpu;
+    w->period_us = period_us;
+    w->inflight_us = MAX30205_ACQUIRE_NEVER;
+    acquire->num++;
+    
+    return 0;
+}
+
+/**
+ * @brief     set the real-time mode
+ * @param[in] *acquire pointer to a max30205 acquire structure
+ * @param[in] priority SCHED_FIFO priority of the bus workers, 0 for the default policy
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 runtime is running
+ *            - 5 priority is invalid
+ * @note      in real-time mode start locks the process memory, pre-faults the buffers and the worker stacks,
+ *            the process and sink functions run on the workers and must not allocate, print or block either
+ */
+uint8_t max30205_acquire_set_realtime(max30205_acquire_t *acquire, int priority)
+{
+    if (acquire == NULL)
+    {
+        return 2;
+    }
+    if (acquire->running != 0)
+    {
+        return 4;
+    }
+    if ((priority != 0) && ((priority < sched_get_priority_min(SCHED_FIFO)) ||
+                            (priority > sched_get_priority_max(SCHED_FIFO))))
+    {
+        return 5;
+    }
+    
+    acquire->priority = priority;
+    
+    return 0;
+}
+
+/**
+ * @brief     start the bus workers
+ * @param[in] *acquire pointer to a max30205 acquire structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ *            - 2 handle is NULL
+ *            - 4 runtime is running
+ *            - 5 real-time setup failed
+ * @note      the latency histograms restart from zero,
+ *            real-time mode needs CAP_SYS_NICE and CAP_IPC_LOCK or a matching rlimit
+ */
+uint8_t max30205_acquire_start(max30205_acquire_t *acquire)
+{
+    pthread_attr_t attr;
+    struct sched_param param;
+    uint64_t now;
+    uint8_t i;
+    
+    if (acquire == NULL)
+    {
+        return 2;
+    }
+    if (acquire->running != 0)
+    {
+        return 4;
+    }
+    
+    /* real-time mode: lock every page and fault the buffers in */
+    if (acquire->priority != 0)
+    {
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+        {
+            return 5;
+        }
+        acquire->locked = 1;
+        memset(acquire->heap, 0, sizeof(acquire->heap));
+        for (i = 0; i < acquire->num; i++)
+        {
+            memset(acquire->worker[i].queue, 0, sizeof(acquire->worker[i].queue));
+        }
+    }
+    if (pthread_attr_init(&attr) != 0)
+    {
+        a_acquire_unlock(acquire);
+        
+        return 1;
+    }
+    if (acquire->priority != 0)
+    {
+        memset(&param, 0, sizeof(struct sched_param));
+        param.sched_priority = acquire->priority;
+        if ((pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED) != 0) ||
+            (pthread_attr_setschedpolicy(&attr, SCHED_FIFO) != 0) ||
+            (pthread_attr_setschedparam(&attr, &param) != 0))
+        {
+            (void)pthread_attr_destroy(&attr);
+            a_acquire_unlock(acquire);
+            
+            return 5;
+        }
+    }
+    
+    now = a_acquire_now_us();
+    for (i = 0; i < acquire->num; i++)
+    {
+        acquire->worker[i].floor_us = now;
+        memset(acquire->worker[i].latency, 0, sizeof(acquire->worker[i].latency));
+        acquire->worker[i].latency_max_us = 0;
+        acquire->worker[i].cycles = 0;
+    }
+    __atomic_store_n(&acquire->running, 1, __ATOMIC_RELEASE);
+    for (i = 0; i < acquire->num; i++)
+    {
+        if (pthread_create(&acquire->worker[i].thread, &attr, a_acquire_worker, &acquire->worker[i]) != 0)
+        {
+            /* stop the started ones */
+            __atomic_store_n(&acquire->running, 0, __ATOMIC_RELEASE);
+            while (i > 0)
+            {
+                i--;
+                (void)pthread_join(acquire->worker[i].thread, NULL);
+            }
+            (void)pthread_attr_destroy(&attr);
+            a_acquire_unlock(acquire);
+            
+            return (acquire->priority != 0) ? 5 : 1;
+        }
+    }
+    (void)pthread_attr_destroy(&attr);
+    
+    return 0;
+}
+
+/**
+ * @brief     stop the bus workers
+ * @param[in] *acquire pointer to a max30205 acquire structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 runtime is not running
+ * @note      the queued samples are processed and flushed to the sink before it returns
+ */
+uint8_t max30205_acquire_stop(max30205_acquire_t *acquire)
+{
+    max30205_acquire_sample_t sample;
+    uint8_t i;
+    
+    if (acquire == NULL)
+    {
+        return 2;
+    }
+    if (acquire->running == 0)
+    {
+        return 4;
+    }
+    
+    /* join the workers */
+    __atomic_store_n(&acquire->running, 0, __ATOMIC_RELEASE);
+    for (i = 0; i < acquire->num; i++)
+    {
+        (void)pthread_join(acquire->worker[i].thread, NULL);
+    }
+    
+    /* drain the queues, no bus reads any more */
+    for (i = 0; i < acquire->num; i++)
+    {
+        acquire->worker[i].floor_us = MAX30205_ACQUIRE_NEVER;
+    }
+    for (i = 0; i < acquire->num; i++)
+    {
+        while (a_acquire_take(&acquire->worker[i], &acquire->worker[i], &sample) == 0)
+        {
+            a_acquire_process(&acquire->worker[i], &sample);
+        }
+    }
+    (void)pthread_mutex_lock(&acquire->mutex);
+    while (acquire->heap_len > 0)
+    {
+        a_acquire_heap_emit(acquire);
+    }
+    (void)pthread_mutex_unlock(&acquire->mutex);
+    a_acquire_unlock(acquire);
+    
+    return 0;
+}
+
+/**
+ * @brief      get the bus statistics
+ * @param[in]  *acquire pointer to a max30205 acquire structure
+ * @param[in]  bus bus index
+ * @param[out] *samples pointer to a read samples buffer
+ * @param[out] *processed pointer to a processed samples buffer
+ * @param[out] *stolen pointer to a stolen samples buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 5 bus is invalid
+ * @note       processed and stolen count the work done by the bus worker for any bus
+ */
+uint8_t max30205_acquire_get_stats(max30205_acquire_t *acquire, uint8_t bus,
+                                   uint64_t *samples, uint64_t *processed, uint64_t *stolen)
+{
+    if ((acquire == NULL) || (samples == NULL) || (processed == NULL) || (stolen == NULL))
+    {
+        return 2;
+    }
+    if (bus >= acquire->num)
+    {
+        return 5;
+    }
+    
+    *samples = acquire->worker[bus].samples;
+    *processed = acquire->worker[bus].processed;
+    *stolen = acquire->worker[bus].stolen;
+    
+    return 0;
+}
+
+/**
+ * @brief      get the cycle latency of a bus
+ * @param[in]  *acquire pointer to a max30205 acquire structure
+ * @param[in]  bus bus index
+ * @param[out] *latency pointer to a max30205 acquire latency structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 5 bus is invalid
+ * @note       the cycle latency runs from the scheduled sweep start to the end of the sweep,
+ *             a free running bus schedules every sweep at the time it begins
+ */
+uint8_t max30205_acquire_get_latency(max30205_acquire_t *acquire, uint8_t bus, max30205_acquire_latency_t *latency)
+{
+    max30205_acquire_worker_t *w;
+    uint64_t target[3];
+    uint64_t cycles;
+    uint64_t sum;
+    uint32_t *out[3];
+    uint32_t i;
+    uint8_t k;
+    
+    if ((acquire == NULL) || (latency == NULL))
+    {
+        return 2;
+    }
+    if (bus >= acquire->num)
+    {
+        return 5;
+    }
+    
+    w = &acquire->worker[bus];
+    memset(latency, 0, sizeof(max30205_acquire_latency_t));
+    cycles = __atomic_load_n(&w->cycles, __ATOMIC_RELAXED);
+    latency->cycles = cycles;
+    latency->max_us = w->latency_max_us;
+    if (cycles == 0)
+    {
+        return 0;
+    }
+    
+    /* nearest rank percentiles, the overflow bucket reports the worst case */
+    target[0] = (cycles * 500 + 999) / 1000;
+    target[1] = (cycles * 990 + 999) / 1000;
+    target[2] = (cycles * 999 + 999) / 1000;
+    out[0] = &latency->p50_us;
+    out[1] = &latency->p99_us;
+    out[2] = &latency->p999_us;
+    sum = 0;
+    k = 0;
+    for (i = 0; (i < MAX30205_ACQUIRE_LATENCY_MAX) && (k < 3); i++)
+    {
+        sum += w->latency[i];
+        while ((k < 3) && (sum >= target[k]))
+        {
+            *out[k] = (i == MAX30205_ACQUIRE_LATENCY_MAX - 1) ? w->latency_max_us : i;
+            k++;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     benchmark sink
+ * @param[in] *sample pointer to a sample
+ * @param[in] *user pointer to user data
+ * @note      none
+ */
+static void a_acquire_benchmark_sink(const max30205_acquire_sample_t *sample, void *user)
+{
+    (void)sample;
+    (void)user;
+}
+
+static max30205_acquire_t gs_benchmark;        /**< benchmark runtime */
+
+/**
+ * @brief      run the jitter benchmark
+ * @param[in]  *handle pointer to an initialized and started max30205 handle
+ * @param[in]  period_us sweep period, 0 for free running sweeps
+ * @param[in]  cycles measured sweeps
+ * @param[in]  priority SCHED_FIFO priority, 0 for the default policy
+ * @param[in]  cpu cpu to pin the worker on, -1 for none
+ * @param[out] *latency pointer to a max30205 acquire latency structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ *             - 2 handle is NULL
+ *             - 5 real-time setup failed or priority is invalid
+ * @note       it runs one bus worker on a static runtime, so it is not reentrant
+ */
+uint8_t max30205_acquire_benchmark(max30205_handle_t *handle, uint32_t period_us, uint32_t cycles,
+                                   int priority, int cpu, max30205_acquire_latency_t *latency)
+{
+    static max30205_handle_t *list[1];
+    uint8_t res;
+    
+    if ((handle == NULL) || (latency == NULL))
+    {
+        return 2;
+    }
+    
+    memset(latency, 0, sizeof(max30205_acquire_latency_t));
+    list[0] = handle;
+    if (max30205_acquire_init(&gs_benchmark, NULL, a_acquire_benchmark_sink, NULL) != 0)
+    {
+        return 1;
+    }
+    res = max30205_acquire_add_bus(&gs_benchmark, list, 1, cpu, period_us);
+    if (res == 0)
+    {
+        res = max30205_acquire_set_realtime(&gs_benchmark, priority);
+    }
+    if (res == 0)
+    {
+        res = max30205_acquire_start(&gs_benchmark);
+    }
+    if (res != 0)
+    {
+        (void)max30205_acquire_deinit(&gs_benchmark);
+        
+        return (res == 5) ? 5 : 1;
+    }
+    
+    /* the caller only polls, the worker does all the timing */
+    while (__atomic_load_n(&gs_benchmark.worker[0].cycles, __ATOMIC_RELAXED) < cycles)
+    {
+        (void)usleep(10000);
+    }
+    (void)max30205_acquire_stop(&gs_benchmark);
+    (void)max30205_acquire_get_latency(&gs_benchmark, 0, latency);
+    (void)max30205_acquire_deinit(&gs_benchmark);
+    
+    return 0;
+}
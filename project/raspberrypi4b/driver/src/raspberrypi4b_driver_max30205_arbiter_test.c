@@ -0,0 +1,518 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_max30205_arbiter_test.c
+ * @brief     raspberrypi4b driver max30205 arbiter test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "raspberrypi4b_driver_max30205_arbiter_test.h"
+#include "driver_max30205_arbiter.h"
+#include "driver_max30205_test_fixture.h"
+#include "mutex.h"
+
+/**
+ * @brief arbiter test reader number definition
+ */
+#define MAX30205_ARBITER_TEST_READERS        4         /**< reader threads */
+#define MAX30205_ARBITER_TEST_TIMES          50        /**< reads of each reader */
+#define MAX30205_ARBITER_TEST_JOBS           5         /**< queued jobs of the order test */
+#define MAX30205_ARBITER_TEST_TIMEOUT        1000      /**< ms to wait for a queued job */
+
+/**
+ * @brief arbiter test job structure definition
+ */
+typedef struct max30205_arbiter_test_job_s
+{
+    max30205_arbiter_request_t request;        /**< arbiter request */
+    pthread_t thread;                          /**< submitting thread */
+    uint8_t id;                                /**< job id */
+    uint8_t hold;                              /**< 1 keeps the transaction on the bus */
+    uint8_t running;                           /**< transaction is on the bus */
+    uint8_t started;                           /**< thread is started */
+} max30205_arbiter_test_job_t;
+
+static max30205_handle_t gs_handle;                                            /**< max30205 handle */
+static max30205_arbiter_t gs_arbiter;                                          /**< max30205 arbiter */
+static mutex_handle_t gs_mutex;                                                /**< bus mutex */
+static uint8_t gs_lock_fail;                                                   /**< lock calls left until one fails, 0 for none */
+static uint8_t gs_unlock_fail;                                                 /**< unlock calls left until one reports a failure, 0 for none */
+static uint8_t gs_reader_res[MAX30205_ARBITER_TEST_READERS];                   /**< reader results */
+static max30205_arbiter_test_job_t gs_job[MAX30205_ARBITER_TEST_JOBS];         /**< order test jobs */
+static uint8_t gs_order[MAX30205_ARBITER_TEST_JOBS];                           /**< job ids in run order */
+static uint8_t gs_order_len;                                                   /**< run jobs */
+
+/**
+ * @brief     lock with an injected failure
+ * @param[in] *mutex pointer to a mutex handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ * @note      a failed lock does not take the mutex
+ */
+static uint8_t a_max30205_arbiter_test_lock(void *mutex)
+{
+    if (gs_lock_fail != 0)
+    {
+        gs_lock_fail--;
+        if (gs_lock_fail == 0)
+        {
+            return 1;
+        }
+    }
+    
+    return mutex_lock(mutex);
+}
+
+/**
+ * @brief     unlock with an injected failure
+ * @param[in] *mutex pointer to a mutex handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 unlock failed
+ * @note      a failed unlock still releases the mutex
+ */
+static uint8_t a_max30205_arbiter_test_unlock(void *mutex)
+{
+    uint8_t res;
+    
+    res = mutex_unlock(mutex);
+    if (gs_unlock_fail != 0)
+    {
+        gs_unlock_fail--;
+        if (gs_unlock_fail == 0)
+        {
+            return 1;
+        }
+    }
+    
+    return res;
+}
+
+/**
+ * @brief     reader thread
+ * @param[in] *arg pointer to the reader result
+ * @return    NULL
+ * @note      none
+ */
+static void *a_max30205_arbiter_test_reader(void *arg)
+{
+    uint8_t *res = (uint8_t *)arg;
+    uint32_t i;
+    int16_t raw;
+    float s;
+    
+    *res = 0;
+    for (i = 0; i < MAX30205_ARBITER_TEST_TIMES; i++)
+    {
+        if (max30205_arbiter_continuous_read(&gs_arbiter, &gs_handle, (int16_t *)&raw, (float *)&s) != 0)
+        {
+            *res = 1;
+        }
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     job transaction
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] *args pointer to a job
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      it holds the bus until the job is released and logs the job id
+ */
+static uint8_t a_max30205_arbiter_test_transaction(max30205_handle_t *handle, void *args)
+{
+    max30205_arbiter_test_job_t *job = (max30205_arbiter_test_job_t *)args;
+    int16_t raw;
+    float s;
+    
+    __atomic_store_n(&job->running, 1, __ATOMIC_RELEASE);
+    while (__atomic_load_n(&job->hold, __ATOMIC_ACQUIRE) != 0)
+    {
+        max30205_interface_delay_ms(1);
+    }
+    gs_order[gs_order_len] = job->id;
+    gs_order_len++;
+    
+    return max30205_continuous_read(handle, (int16_t *)&raw, (float *)&s);
+}
+
+/**
+ * @brief     job thread
+ * @param[in] *arg pointer to a job
+ * @return    NULL
+ * @note      none
+ */
+static void *a_max30205_arbiter_test_submit(void *arg)
+{
+    max30205_arbiter_test_job_t *job = (max30205_arbiter_test_job_t *)arg;
+    
+    (void)max30205_arbiter_submit(&gs_arbiter, &job->request);
+    
+    return NULL;
+}
+
+/**
+ * @brief     count the queued requests
+ * @return    queued requests
+ * @note      none
+ */
+static uint8_t a_max30205_arbiter_test_queued(void)
+{
+    max30205_arbiter_request_t *p;
+    uint8_t num;
+    uint8_t i;
+    
+    num = 0;
+    (void)mutex_lock(&gs_mutex);
+    for (i = 0; i < MAX30205_ARBITER_PRIORITY_MAX; i++)
+    {
+        for (p = gs_arbiter.head[i]; p != NULL; p = p->next)
+        {
+            num++;
+        }
+    }
+    (void)mutex_unlock(&gs_mutex);
+    
+    return num;
+}
+
+/**
+ * @brief     submit a job from a new thread and wait until it is queued or running
+ * @param[in] index job index
+ * @param[in] priority job priority
+ * @param[in] hold 1 keeps the transaction on the bus until it is released
+ * @param[in] queued queued requests to wait for, 0 waits for the transaction to run
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      none
+ */
+static uint8_t a_max30205_arbiter_test_start(uint8_t index, max30205_arbiter_priority_t priority, uint8_t hold, uint8_t queued)
+{
+    max30205_arbiter_test_job_t *job = &gs_job[index];
+    uint32_t i;
+    
+    job->id = index;
+    job->hold = hold;
+    job->running = 0;
+    job->request.handle = &gs_handle;
+    job->request.transaction = a_max30205_arbiter_test_transaction;
+    job->request.args = job;
+    job->request.priority = priority;
+    job->request.res = 0;
+    job->started = 0;
+    if (pthread_create(&job->thread, NULL, a_max30205_arbiter_test_submit, job) != 0)
+    {
+        max30205_interface_debug_print("max30205: create job %d failed.\n", index);
+        
+        return 1;
+    }
+    job->started = 1;
+    for (i = 0; i < MAX30205_ARBITER_TEST_TIMEOUT; i++)
+    {
+        if (((queued == 0) && (__atomic_load_n(&job->running, __ATOMIC_ACQUIRE) != 0)) ||
+            ((queued != 0) && (a_max30205_arbiter_test_queued() == queued)))
+        {
+            return 0;
+        }
+        max30205_interface_delay_ms(1);
+    }
+    max30205_interface_debug_print("max30205: job %d is not queued.\n", index);
+    
+    return 1;
+}
+
+/**
+ * @brief     release the jobs, wait for them and check the run order
+ * @param[in] num started jobs
+ * @param[in] *order pointer to the expected job ids
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_max30205_arbiter_test_finish(uint8_t num, const uint8_t *order)
+{
+    uint8_t res;
+    uint8_t i;
+    
+    res = 0;
+    for (i = 0; i < num; i++)
+    {
+        __atomic_store_n(&gs_job[i].hold, 0, __ATOMIC_RELEASE);
+    }
+    for (i = 0; i < num; i++)
+    {
+        if (gs_job[i].started == 0)
+        {
+            res = 1;
+            
+            continue;
+        }
+        (void)pthread_join(gs_job[i].thread, NULL);
+        if (gs_job[i].request.res != 0)
+        {
+            res = 1;
+        }
+    }
+    if ((res != 0) || (gs_order_len != num))
+    {
+        max30205_interface_debug_print("max30205: %d of %d jobs ran.\n", gs_order_len, num);
+        
+        return 1;
+    }
+    for (i = 0; i < num; i++)
+    {
+        if (gs_order[i] != order[i])
+        {
+            max30205_interface_debug_print("max30205: job %d ran as number %d.\n", gs_order[i], i);
+            
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     arbiter test
+ * @param[in] addr iic device address
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the arbiter runs on the pthread mutex port and the readers are pthreads
+ */
+uint8_t max30205_arbiter_test(max30205_address_t addr)
+{
+    uint8_t res;
+    uint8_t i;
+    int16_t raw;
+    float s;
+    uint32_t promoted;
+    pthread_t reader[MAX30205_ARBITER_TEST_READERS];
+    const uint8_t priority_order[MAX30205_ARBITER_TEST_JOBS] = {0, 4, 3, 2, 1};
+    const uint8_t aging_order[MAX30205_ARBITER_TEST_JOBS] = {0, 2, 1, 3, 4};
+    
+    /* start arbiter test */
+    max30205_interface_debug_print("max30205: start arbiter test.\n");
+    res = max30205_test_fixture_init(&gs_handle, addr, MAX30205_FAULT_QUEUE_1);
+    if (res != 0)
+    {
+        return 1;
+    }
+    res = mutex_init(&gs_mutex);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: mutex init failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    gs_lock_fail = 0;
+    gs_unlock_fail = 0;
+    DRIVER_MAX30205_ARBITER_LINK_INIT(&gs_arbiter, max30205_arbiter_t);
+    DRIVER_MAX30205_ARBITER_LINK_LOCK(&gs_arbiter, a_max30205_arbiter_test_lock);
+    DRIVER_MAX30205_ARBITER_LINK_UNLOCK(&gs_arbiter, a_max30205_arbiter_test_unlock);
+    DRIVER_MAX30205_ARBITER_LINK_WAIT(&gs_arbiter, mutex_wait);
+    DRIVER_MAX30205_ARBITER_LINK_NOTIFY(&gs_arbiter, mutex_notify);
+    DRIVER_MAX30205_ARBITER_LINK_MUTEX(&gs_arbiter, &gs_mutex);
+    res = max30205_arbiter_init(&gs_arbiter);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: arbiter init failed.\n");
+        (void)mutex_deinit(&gs_mutex);
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* concurrent read test */
+    max30205_interface_debug_print("max30205: concurrent read test.\n");
+    for (i = 0; i < MAX30205_ARBITER_TEST_READERS; i++)
+    {
+        if (pthread_create(&reader[i], NULL, a_max30205_arbiter_test_reader, &gs_reader_res[i]) != 0)
+        {
+            max30205_interface_debug_print("max30205: create reader failed.\n");
+            while (i != 0)
+            {
+                i--;
+                (void)pthread_join(reader[i], NULL);
+            }
+            (void)mutex_deinit(&gs_mutex);
+            (void)max30205_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    res = 0;
+    for (i = 0; i < MAX30205_ARBITER_TEST_READERS; i++)
+    {
+        (void)pthread_join(reader[i], NULL);
+        res |= gs_reader_res[i];
+    }
+    if ((res != 0) || (gs_arbiter.transactions != MAX30205_ARBITER_TEST_READERS * MAX30205_ARBITER_TEST_TIMES))
+    {
+        max30205_interface_debug_print("max30205: %d transactions ran and a read failed is %d.\n", gs_arbiter.transactions, res);
+        (void)mutex_deinit(&gs_mutex);
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: %d readers ran %d transactions in %d combiner runs.\n",
+                                   MAX30205_ARBITER_TEST_READERS, gs_arbiter.transactions, gs_arbiter.batches);
+    
+    /* priority test */
+    max30205_interface_debug_print("max30205: priority test.\n");
+    gs_order_len = 0;
+    res = a_max30205_arbiter_test_start(0, MAX30205_ARBITER_PRIORITY_CONTROL, 1, 0);
+    res |= a_max30205_arbiter_test_start(1, MAX30205_ARBITER_PRIORITY_BACKGROUND, 0, 1);
+    res |= a_max30205_arbiter_test_start(2, MAX30205_ARBITER_PRIORITY_PERIODIC, 0, 2);
+    res |= a_max30205_arbiter_test_start(3, MAX30205_ARBITER_PRIORITY_CONTROL, 0, 3);
+    res |= a_max30205_arbiter_test_start(4, MAX30205_ARBITER_PRIORITY_ALARM, 0, 4);
+    res |= a_max30205_arbiter_test_finish(5, priority_order);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: priority test failed.\n");
+        (void)mutex_deinit(&gs_mutex);
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: alarm, control, periodic and background run in order.\n");
+    
+    /* aging test */
+    max30205_interface_debug_print("max30205: aging test.\n");
+    res = max30205_arbiter_set_aging(&gs_arbiter, 2);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: set aging failed.\n");
+        (void)mutex_deinit(&gs_mutex);
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    promoted = gs_arbiter.promoted;
+    gs_order_len = 0;
+    res = a_max30205_arbiter_test_start(0, MAX30205_ARBITER_PRIORITY_CONTROL, 1, 0);
+    res |= a_max30205_arbiter_test_start(1, MAX30205_ARBITER_PRIORITY_BACKGROUND, 0, 1);
+    res |= a_max30205_arbiter_test_start(2, MAX30205_ARBITER_PRIORITY_CONTROL, 1, 2);
+    __atomic_store_n(&gs_job[0].hold, 0, __ATOMIC_RELEASE);
+    for (i = 0; (i < 100) && (__atomic_load_n(&gs_job[2].running, __ATOMIC_ACQUIRE) == 0); i++)
+    {
+        max30205_interface_delay_ms(10);
+    }
+    res |= a_max30205_arbiter_test_start(3, MAX30205_ARBITER_PRIORITY_CONTROL, 0, 2);
+    res |= a_max30205_arbiter_test_start(4, MAX30205_ARBITER_PRIORITY_CONTROL, 0, 3);
+    res |= a_max30205_arbiter_test_finish(5, aging_order);
+    if ((res != 0) || (gs_arbiter.promoted != promoted + 1))
+    {
+        max30205_interface_debug_print("max30205: aging test failed.\n");
+        (void)mutex_deinit(&gs_mutex);
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: background request aged past 2 control requests.\n");
+    
+    /* lock failure test */
+    max30205_interface_debug_print("max30205: lock failure test.\n");
+    gs_lock_fail = 1;
+    res = max30205_arbiter_continuous_read(&gs_arbiter, &gs_handle, (int16_t *)&raw, (float *)&s);
+    if (res != 1)
+    {
+        max30205_interface_debug_print("max30205: failed submit lock is not reported.\n");
+        (void)mutex_deinit(&gs_mutex);
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    gs_lock_fail = 2;
+    res = max30205_arbiter_continuous_read(&gs_arbiter, &gs_handle, (int16_t *)&raw, (float *)&s);
+    if ((res != 1) || (gs_arbiter.busy != 1))
+    {
+        max30205_interface_debug_print("max30205: failed combiner lock is not reported.\n");
+        (void)mutex_deinit(&gs_mutex);
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    gs_unlock_fail = 1;
+    res = max30205_arbiter_set_aging(&gs_arbiter, MAX30205_ARBITER_AGING_DEFAULT);
+    if (res != 1)
+    {
+        max30205_interface_debug_print("max30205: failed unlock is not reported.\n");
+        (void)mutex_deinit(&gs_mutex);
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = max30205_arbiter_init(&gs_arbiter);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: arbiter init failed.\n");
+        (void)mutex_deinit(&gs_mutex);
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = max30205_arbiter_continuous_read(&gs_arbiter, &gs_handle, (int16_t *)&raw, (float *)&s);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: read after init failed.\n");
+        (void)mutex_deinit(&gs_mutex);
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: failed lock and unlock return 1 and init recovers the arbiter.\n");
+    
+    /* stop continuous read */
+    res = max30205_stop_continuous_read(&gs_handle);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: stop continuous read failed.\n");
+        (void)mutex_deinit(&gs_mutex);
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* finished arbiter test */
+    max30205_interface_debug_print("max30205: finished arbiter test.\n");
+    (void)mutex_deinit(&gs_mutex);
+    (void)max30205_deinit(&gs_handle);
+    
+    return 0;
+}
@@ -0,0 +1,234 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_max30205_async_test.c
+ * @brief     raspberrypi4b driver max30205 async test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "raspberrypi4b_driver_max30205_async_test.h"
+#include "driver_max30205_async.h"
+#include "driver_max30205_test_fixture.h"
+#include "mutex.h"
+
+/**
+ * @brief async test timeout definition
+ */
+#define MAX30205_ASYNC_TEST_TIMEOUT        1000        /**< ms to wait for a callback */
+
+static max30205_handle_t gs_handle;                 /**< max30205 handle */
+static max30205_async_request_t gs_request;         /**< max30205 async request */
+static mutex_handle_t gs_mutex;                     /**< callback lock */
+static uint8_t gs_done;                             /**< callback count */
+static uint8_t gs_res;                              /**< callback result */
+static int16_t gs_raw;                              /**< callback raw data */
+static float gs_s;                                  /**< callback converted data */
+
+/**
+ * @brief the async bus on the interface hooks
+ */
+static const max30205_async_t gs_async =
+{
+    max30205_interface_iic_read_async,
+    max30205_interface_iic_write_async,
+    max30205_interface_timer_start,
+};
+
+/**
+ * @brief     request callback
+ * @param[in] *request pointer to a max30205 async request structure
+ * @note      it runs on the worker thread
+ */
+static void a_max30205_async_test_callback(max30205_async_request_t *request)
+{
+    (void)mutex_lock(&gs_mutex);
+    gs_res = request->res;
+    gs_raw = request->raw;
+    gs_s = request->s;
+    gs_done++;
+    (void)mutex_unlock(&gs_mutex);
+}
+
+/**
+ * @brief  wait for the request callback
+ * @return status code
+ *         - 0 success
+ *         - 1 timeout, a failed request or more than one callback
+ * @note   none
+ */
+static uint8_t a_max30205_async_test_wait(void)
+{
+    uint32_t ms;
+    uint8_t done;
+    uint8_t res;
+    
+    for (ms = 0; ms < MAX30205_ASYNC_TEST_TIMEOUT; ms++)
+    {
+        (void)mutex_lock(&gs_mutex);
+        done = gs_done;
+        res = gs_res;
+        (void)mutex_unlock(&gs_mutex);
+        if (done != 0)
+        {
+            break;
+        }
+        max30205_interface_delay_ms(1);
+    }
+    if (done == 0)
+    {
+        max30205_interface_debug_print("max30205: callback timeout.\n");
+        
+        return 1;
+    }
+    
+    /* a late second callback would be a double completion */
+    max30205_interface_delay_ms(10);
+    (void)mutex_lock(&gs_mutex);
+    done = gs_done;
+    gs_done = 0;
+    (void)mutex_unlock(&gs_mutex);
+    if (done != 1)
+    {
+        max30205_interface_debug_print("max30205: callback ran %d times.\n", done);
+        
+        return 1;
+    }
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: request failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  release the test resources
+ * @note   none
+ */
+static void a_max30205_async_test_deinit(void)
+{
+    (void)mutex_deinit(&gs_mutex);
+    (void)max30205_deinit(&gs_handle);
+}
+
+/**
+ * @brief     async test
+ * @param[in] addr iic device address
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the requests run on the worker thread of the interface async hooks and complete
+ *            through callbacks
+ */
+uint8_t max30205_async_test(max30205_address_t addr)
+{
+    uint8_t res;
+    uint8_t conf;
+    
+    /* start async test */
+    max30205_interface_debug_print("max30205: start async test.\n");
+    res = max30205_test_fixture_init(&gs_handle, addr, MAX30205_FAULT_QUEUE_1);
+    if (res != 0)
+    {
+        return 1;
+    }
+    res = mutex_init(&gs_mutex);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: mutex init failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    gs_done = 0;
+    memset(&gs_request, 0, sizeof(max30205_async_request_t));
+    
+    /* continuous read test */
+    max30205_interface_debug_print("max30205: continuous read test.\n");
+    res = max30205_async_continuous_read(&gs_async, &gs_handle, &gs_request, a_max30205_async_test_callback, NULL);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: submit continuous read failed.\n");
+        a_max30205_async_test_deinit();
+        
+        return 1;
+    }
+    if (a_max30205_async_test_wait() != 0)
+    {
+        a_max30205_async_test_deinit();
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: temperature: %.03fC raw 0x%04X.\n", gs_s, (uint16_t)gs_raw);
+    
+    /* single read test */
+    max30205_interface_debug_print("max30205: single read test.\n");
+    res = max30205_async_single_read(&gs_async, &gs_handle, &gs_request, a_max30205_async_test_callback, NULL);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: submit single read failed.\n");
+        a_max30205_async_test_deinit();
+        
+        return 1;
+    }
+    if (a_max30205_async_test_wait() != 0)
+    {
+        a_max30205_async_test_deinit();
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: temperature: %.03fC raw 0x%04X.\n", gs_s, (uint16_t)gs_raw);
+    
+    /* the one-shot leaves the chip in shutdown */
+    res = max30205_test_fixture_get_conf(&gs_handle, &conf);
+    if (res != 0)
+    {
+        a_max30205_async_test_deinit();
+        
+        return 1;
+    }
+    if ((conf & (1 << 0)) == 0)
+    {
+        max30205_interface_debug_print("max30205: chip is not in shutdown.\n");
+        a_max30205_async_test_deinit();
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: check shutdown ok.\n");
+    
+    /* finish async test */
+    max30205_interface_debug_print("max30205: finish async test.\n");
+    a_max30205_async_test_deinit();
+    
+    return 0;
+}
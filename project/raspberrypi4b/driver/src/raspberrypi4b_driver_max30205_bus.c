@@ -0,0 +1,226 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_max30205_bus.c
+ * @brief     raspberrypi4b driver max30205 bus source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "raspberrypi4b_driver_max30205_bus.h"
+#include "iic.h"
+#include <stdarg.h>
+#include <time.h>
+
+/**
+ * @brief     bus iic init
+ * @param[in] *ctx pointer to a linux iic bus structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      the adapter is opened once for all handles on the bus
+ */
+static uint8_t a_max30205_linux_bus_iic_init(void *ctx)
+{
+    max30205_linux_bus_t *linux_bus = (max30205_linux_bus_t *)ctx;
+    
+    if (linux_bus->refs == 0)
+    {
+        if (iic_init(linux_bus->name, &linux_bus->fd) != 0)
+        {
+            return 1;
+        }
+    }
+    linux_bus->refs++;
+    
+    return 0;
+}
+
+/**
+ * @brief     bus iic deinit
+ * @param[in] *ctx pointer to a linux iic bus structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      the adapter is closed with the last handle on the bus
+ */
+static uint8_t a_max30205_linux_bus_iic_deinit(void *ctx)
+{
+    max30205_linux_bus_t *linux_bus = (max30205_linux_bus_t *)ctx;
+    
+    if (linux_bus->refs == 0)
+    {
+        return 1;
+    }
+    if (linux_bus->refs == 1)
+    {
+        if (iic_deinit(linux_bus->fd) != 0)
+        {
+            return 1;
+        }
+        linux_bus->fd = -1;
+    }
+    linux_bus->refs--;
+    
+    return 0;
+}
+
+/**
+ * @brief      bus iic read
+ * @param[in]  *ctx pointer to a linux iic bus structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_max30205_linux_bus_iic_read(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return iic_read(((max30205_linux_bus_t *)ctx)->fd, addr, reg, buf, len);
+}
+
+/**
+ * @brief     bus iic write
+ * @param[in] *ctx pointer to a linux iic bus structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_max30205_linux_bus_iic_write(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return iic_write(((max30205_linux_bus_t *)ctx)->fd, addr, reg, buf, len);
+}
+
+/**
+ * @brief     bus delay
+ * @param[in] *ctx pointer to a linux iic bus structure
+ * @param[in] ms time
+ * @note      only the calling thread sleeps, the other buses keep running
+ */
+static void a_max30205_linux_bus_delay_ms(void *ctx, uint32_t ms)
+{
+    (void)ctx;
+    
+    usleep(1000 * ms);
+}
+
+/**
+ * @brief     bus print format data
+ * @param[in] fmt format data
+ * @note      none
+ */
+static void a_max30205_linux_bus_debug_print(const char *const fmt, ...)
+{
+    char str[256];
+    va_list args;
+    
+    memset((char *)str, 0, sizeof(char) * 256); 
+    va_start(args, fmt);
+    vsnprintf((char *)str, 255, (char const *)fmt, args);
+    va_end(args);
+    
+    (void)printf("%s", str);
+}
+
+/**
+ * @brief     bus timestamp us
+ * @param[in] *ctx pointer to a linux iic bus structure
+ * @return    monotonic time in microseconds
+ * @note      none
+ */
+static uint64_t a_max30205_linux_bus_timestamp_us(void *ctx)
+{
+    struct timespec ts;
+    
+    (void)ctx;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);
+}
+
+/**
+ * @brief linux bus operation table definition
+ */
+static const max30205_ops_t gs_ops =
+{
+    a_max30205_linux_bus_iic_init,
+    a_max30205_linux_bus_iic_deinit,
+    a_max30205_linux_bus_iic_read,
+    a_max30205_linux_bus_iic_write,
+    a_max30205_linux_bus_delay_ms,
+    a_max30205_linux_bus_debug_print,
+    a_max30205_linux_bus_timestamp_us,
+};
+
+/**
+ * @brief     bind a linux iic bus
+ * @param[in] *linux_bus pointer to a linux iic bus structure
+ * @param[in] num iic adapter number of /dev/i2c-N
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      it only fills the structure, the adapter is opened by the first max30205_init on
+ *            the bus and closed by the last max30205_deinit, init and deinit the handles of one
+ *            bus from one thread
+ */
+uint8_t max30205_linux_bus_bind(max30205_linux_bus_t *linux_bus, uint8_t num)
+{
+    if (linux_bus == NULL)
+    {
+        return 2;
+    }
+    
+    memset(linux_bus, 0, sizeof(max30205_linux_bus_t));
+    (void)snprintf(linux_bus->name, sizeof(linux_bus->name), "/dev/i2c-%d", num);
+    linux_bus->fd = -1;
+    linux_bus->bus.ops = &gs_ops;
+    linux_bus->bus.ctx = linux_bus;
+    
+    return 0;
+}
+
+/**
+ * @brief     get the driver bus of a linux iic bus
+ * @param[in] *linux_bus pointer to a linux iic bus structure
+ * @return    pointer to the driver bus to link with DRIVER_MAX30205_LINK_BUS
+ * @note      it needs MAX30205_CONFIG_SHARED_OPS set to 1 to be linked to a handle
+ */
+const max30205_bus_t *max30205_linux_bus_get(max30205_linux_bus_t *linux_bus)
+{
+    return &linux_bus->bus;
+}
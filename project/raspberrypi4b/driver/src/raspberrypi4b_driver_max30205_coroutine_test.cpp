@@ -0,0 +1,198 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_max30205_coroutine_test.cpp
+ * @brief     raspberrypi4b driver max30205 coroutine test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "raspberrypi4b_driver_max30205_coroutine_test.h"
+#include "raspberrypi4b_driver_max30205_reactor.hpp"
+#include "driver_max30205_test_fixture.h"
+
+#include <thread>
+
+/**
+ * @brief coroutine test definition
+ */
+#define MAX30205_COROUTINE_TEST_SLEEP_MS        100        /**< ms of the timer test */
+#define MAX30205_COROUTINE_TEST_TASKS           4          /**< reads in flight together */
+
+static max30205_handle_t gs_handle;        /**< max30205 handle */
+
+/**
+ * @brief the async bus on the interface hooks
+ */
+static const max30205_async_t gs_async =
+{
+    max30205_interface_iic_read_async,
+    max30205_interface_iic_write_async,
+    max30205_interface_timer_start,
+};
+
+/**
+ * @brief     check the coroutine runs on the reactor thread
+ * @param[in] id reactor thread id
+ * @return    status code
+ *            - 0 success
+ *            - 1 resumed on another thread
+ * @note      none
+ */
+static uint8_t a_max30205_coroutine_test_thread(std::thread::id id)
+{
+    if (std::this_thread::get_id() != id)
+    {
+        max30205_interface_debug_print("max30205: resumed outside the reactor.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     coroutine test body
+ * @param[in] r reference to the reactor
+ * @param[in] b reference to the bus binding
+ * @return    task producing the status code
+ * @note      none
+ */
+static max30205::task<uint8_t> a_max30205_coroutine_test_run(max30205::reactor &r, max30205::bus &b)
+{
+    std::thread::id id = std::this_thread::get_id();
+    max30205::reactor::clock::time_point start;
+    max30205::result res;
+    std::vector<max30205::task<max30205::result>> tasks;
+    std::vector<max30205::result> out;
+    long ms;
+    
+    /* continuous read test */
+    max30205_interface_debug_print("max30205: continuous read test.\n");
+    res = co_await max30205::read(b, gs_handle);
+    if ((res.res != 0) || (a_max30205_coroutine_test_thread(id) != 0))
+    {
+        max30205_interface_debug_print("max30205: read failed.\n");
+        
+        co_return 1;
+    }
+    max30205_interface_debug_print("max30205: temperature: %.03fC.\n", res.s);
+    
+    /* timer test */
+    max30205_interface_debug_print("max30205: timer test.\n");
+    start = max30205::reactor::clock::now();
+    co_await r.sleep_for(std::chrono::milliseconds(MAX30205_COROUTINE_TEST_SLEEP_MS));
+    ms = (long)std::chrono::duration_cast<std::chrono::milliseconds>(max30205::reactor::clock::now() - start).count();
+    if ((ms < MAX30205_COROUTINE_TEST_SLEEP_MS) || (a_max30205_coroutine_test_thread(id) != 0))
+    {
+        max30205_interface_debug_print("max30205: timer woke up after %d ms.\n", (int)ms);
+        
+        co_return 1;
+    }
+    max30205_interface_debug_print("max30205: timer woke up after %d ms.\n", (int)ms);
+    
+    /* single read test */
+    max30205_interface_debug_print("max30205: single read test.\n");
+    res = co_await max30205::single_read(b, gs_handle);
+    if ((res.res != 0) || (a_max30205_coroutine_test_thread(id) != 0))
+    {
+        max30205_interface_debug_print("max30205: single read failed.\n");
+        
+        co_return 1;
+    }
+    max30205_interface_debug_print("max30205: temperature: %.03fC.\n", res.s);
+    
+    /* when all test */
+    max30205_interface_debug_print("max30205: when all test.\n");
+    for (int i = 0; i < MAX30205_COROUTINE_TEST_TASKS; i++)
+    {
+        tasks.push_back(max30205::make_task([&b] { return max30205::read(b, gs_handle); }));
+    }
+    out = co_await max30205::when_all(std::span<max30205::task<max30205::result>>(tasks));
+    if (a_max30205_coroutine_test_thread(id) != 0)
+    {
+        co_return 1;
+    }
+    for (const max30205::result &o : out)
+    {
+        if (o.res != 0)
+        {
+            max30205_interface_debug_print("max30205: read failed.\n");
+            
+            co_return 1;
+        }
+    }
+    max30205_interface_debug_print("max30205: %d reads completed.\n", (int)out.size());
+    
+    co_return 0;
+}
+
+/**
+ * @brief     coroutine test
+ * @param[in] addr iic device address
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the coroutines run on the reactor and the transfers on the worker thread of the
+ *            interface async hooks
+ */
+uint8_t max30205_coroutine_test(max30205_address_t addr)
+{
+    uint8_t res;
+    
+    /* start coroutine test */
+    max30205_interface_debug_print("max30205: start coroutine test.\n");
+    res = max30205_test_fixture_init(&gs_handle, addr, MAX30205_FAULT_QUEUE_1);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* run on the reactor */
+    {
+        max30205::reactor r;
+        max30205::bus b(gs_async, r);
+        max30205::task<uint8_t> t = a_max30205_coroutine_test_run(r, b);
+        
+        res = r.run(t);
+    }
+    if (res != 0)
+    {
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* finish coroutine test */
+    max30205_interface_debug_print("max30205: finish coroutine test.\n");
+    (void)max30205_deinit(&gs_handle);
+    
+    return 0;
+}
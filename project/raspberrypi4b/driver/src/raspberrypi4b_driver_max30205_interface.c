@@ -38,6 +38,9 @@
 #include "driver_max30205_interface.h"
 #include "iic.h"
 #include <stdarg.h>
+#include <time.h>
+#include <errno.h>
+#include <pthread.h>
 
 /**
  * @brief iic device name definition
@@ -49,6 +52,45 @@
  */
 static int gs_fd;                           /**< iic handle */
 
+/**
+ * @brief async queue length definition
+ */
+#define ASYNC_JOB_MAX 16                    /**< max queued transfers and timers */
+
+/**
+ * @brief async job type enumeration definition
+ */
+typedef enum
+{
+    ASYNC_JOB_READ  = 0x00,        /**< iic read */
+    ASYNC_JOB_WRITE = 0x01,        /**< iic write */
+    ASYNC_JOB_TIMER = 0x02,        /**< timer expiry */
+} async_job_type_t;
+
+/**
+ * @brief async job structure definition
+ */
+typedef struct async_job_s
+{
+    uint8_t type;                                 /**< job type */
+    uint8_t addr;                                 /**< iic device write address */
+    uint8_t reg;                                  /**< iic register address */
+    uint8_t *buf;                                 /**< data buffer */
+    uint16_t len;                                 /**< data buffer length */
+    uint64_t due_us;                              /**< time the job is due */
+    max30205_async_request_t *request;            /**< owning request */
+} async_job_t;
+
+/**
+ * @brief async worker definition
+ */
+static pthread_once_t gs_async_once = PTHREAD_ONCE_INIT;              /**< worker start once */
+static pthread_mutex_t gs_async_mutex = PTHREAD_MUTEX_INITIALIZER;    /**< queue lock */
+static pthread_cond_t gs_async_cond;                                  /**< queue signal */
+static uint8_t gs_async_ready = 0;                                    /**< worker started flag */
+static async_job_t gs_async_job[ASYNC_JOB_MAX];                       /**< queued jobs */
+static uint8_t gs_async_num = 0;                                      /**< queued job count */
+
 /**
  * @brief  interface iic bus init
  * @return status code
@@ -132,3 +174,321 @@ void max30205_interface_debug_print(const char *const fmt, ...)
     
     (void)printf((uint8_t *)str);
 }
+
+/**
+ * @brief  interface timestamp us
+ * @return monotonic time in microseconds
+ * @note   none
+ */
+uint64_t max30205_interface_timestamp_us(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);
+}
+
+/**
+ * @brief     interface sleep until
+ * @param[in] deadline_us absolute time on the max30205_interface_timestamp_us clock
+ * @note      it returns at once when the deadline has passed
+ */
+void max30205_interface_sleep_until_us(uint64_t deadline_us)
+{
+    struct timespec ts;
+    
+    ts.tv_sec = (time_t)(deadline_us / 1000000ULL);
+    ts.tv_nsec = (long)(deadline_us % 1000000ULL) * 1000L;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+    {
+        /* restart after a signal */
+    }
+}
+
+/**
+ * @brief      interface iic bus read with a timeout
+ * @param[in]  *ctx pointer to a bus context
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  timeout_us time after which the read gives up
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the adapter timeout runs in 10 ms steps, a shorter timeout still waits up to 10 ms, and
+ *             the previous adapter timeout is set again after the transfer
+ */
+uint8_t max30205_interface_iic_read_timeout(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf,
+                                            uint16_t len, uint32_t timeout_us)
+{
+    uint8_t res;
+    uint32_t saved_us;
+    
+    (void)ctx;
+    
+    /* the adapter timeout is shared, so restore it after the transfer */
+    saved_us = iic_get_timeout(gs_fd);
+    if (iic_set_timeout(gs_fd, timeout_us) != 0)
+    {
+        return 1;
+    }
+    res = iic_read(gs_fd, addr, reg, buf, len);
+    if (iic_set_timeout(gs_fd, saved_us) != 0)
+    {
+        return 1;
+    }
+    
+    return res;
+}
+
+/**
+ * @brief     interface iic bus write with a timeout
+ * @param[in] *ctx pointer to a bus context
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @param[in] timeout_us time after which the write gives up
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the adapter timeout runs in 10 ms steps, a shorter timeout still waits up to 10 ms, and
+ *            the previous adapter timeout is set again after the transfer
+ */
+uint8_t max30205_interface_iic_write_timeout(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf,
+                                             uint16_t len, uint32_t timeout_us)
+{
+    uint8_t res;
+    uint32_t saved_us;
+    
+    (void)ctx;
+    
+    /* the adapter timeout is shared, so restore it after the transfer */
+    saved_us = iic_get_timeout(gs_fd);
+    if (iic_set_timeout(gs_fd, timeout_us) != 0)
+    {
+        return 1;
+    }
+    res = iic_write(gs_fd, addr, reg, buf, len);
+    if (iic_set_timeout(gs_fd, saved_us) != 0)
+    {
+        return 1;
+    }
+    
+    return res;
+}
+
+/**
+ * @brief     async worker thread
+ * @param[in] *arg unused
+ * @return    NULL
+ * @note      it runs the earliest due job, transfers are due at once and keep their order, and
+ *            calls max30205_async_complete outside the queue lock
+ */
+static void *a_async_worker(void *arg)
+{
+    async_job_t job;
+    struct timespec ts;
+    uint8_t next;
+    uint8_t res;
+    uint8_t i;
+    
+    (void)arg;
+    
+    (void)pthread_mutex_lock(&gs_async_mutex);
+    while (1)
+    {
+        /* wait for a job */
+        if (gs_async_num == 0)
+        {
+            (void)pthread_cond_wait(&gs_async_cond, &gs_async_mutex);
+            
+            continue;
+        }
+        
+        /* wait for the earliest due one */
+        next = 0;
+        for (i = 1; i < gs_async_num; i++)
+        {
+            if (gs_async_job[i].due_us < gs_async_job[next].due_us)
+            {
+                next = i;
+            }
+        }
+        if (gs_async_job[next].due_us > max30205_interface_timestamp_us())
+        {
+            ts.tv_sec = (time_t)(gs_async_job[next].due_us / 1000000ULL);
+            ts.tv_nsec = (long)(gs_async_job[next].due_us % 1000000ULL) * 1000L;
+            (void)pthread_cond_timedwait(&gs_async_cond, &gs_async_mutex, &ts);
+            
+            continue;
+        }
+        job = gs_async_job[next];
+        for (i = next; i + 1 < gs_async_num; i++)
+        {
+            gs_async_job[i] = gs_async_job[i + 1];
+        }
+        gs_async_num--;
+        (void)pthread_mutex_unlock(&gs_async_mutex);
+        
+        /* run it, the completion may queue the next step */
+        if (job.type == ASYNC_JOB_READ)
+        {
+            res = iic_read(gs_fd, job.addr, job.reg, job.buf, job.len);
+        }
+        else if (job.type == ASYNC_JOB_WRITE)
+        {
+            res = iic_write(gs_fd, job.addr, job.reg, job.buf, job.len);
+        }
+        else
+        {
+            res = 0;
+        }
+        (void)max30205_async_complete(job.request, res);
+        (void)pthread_mutex_lock(&gs_async_mutex);
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief start the async worker
+ * @note  the condition waits on the monotonic clock of max30205_interface_timestamp_us
+ */
+static void a_async_start(void)
+{
+    pthread_condattr_t attr;
+    pthread_t thread;
+    
+    if (pthread_condattr_init(&attr) != 0)
+    {
+        return;
+    }
+    if ((pthread_condattr_setclock(&attr, CLOCK_MONOTONIC) != 0) ||
+        (pthread_cond_init(&gs_async_cond, &attr) != 0))
+    {
+        (void)pthread_condattr_destroy(&attr);
+        
+        return;
+    }
+    (void)pthread_condattr_destroy(&attr);
+    if (pthread_create(&thread, NULL, a_async_worker, NULL) != 0)
+    {
+        (void)pthread_cond_destroy(&gs_async_cond);
+        
+        return;
+    }
+    (void)pthread_detach(thread);
+    gs_async_ready = 1;
+}
+
+/**
+ * @brief     queue an async job
+ * @param[in] *job pointer to a job
+ * @return    status code
+ *            - 0 success
+ *            - 1 queue failed
+ * @note      the worker starts on the first job and serves the process from then on
+ */
+static uint8_t a_async_queue(const async_job_t *job)
+{
+    (void)pthread_once(&gs_async_once, a_async_start);
+    if (gs_async_ready == 0)
+    {
+        return 1;
+    }
+    
+    (void)pthread_mutex_lock(&gs_async_mutex);
+    if (gs_async_num == ASYNC_JOB_MAX)
+    {
+        (void)pthread_mutex_unlock(&gs_async_mutex);
+        
+        return 1;
+    }
+    gs_async_job[gs_async_num] = *job;
+    gs_async_num++;
+    (void)pthread_cond_signal(&gs_async_cond);
+    (void)pthread_mutex_unlock(&gs_async_mutex);
+    
+    return 0;
+}
+
+/**
+ * @brief      interface non-blocking iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  *request pointer to the max30205 async request that owns the transfer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the worker thread runs the transfer and the completion
+ */
+uint8_t max30205_interface_iic_read_async(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                                          max30205_async_request_t *request)
+{
+    async_job_t job;
+    
+    memset(&job, 0, sizeof(async_job_t));
+    job.type = ASYNC_JOB_READ;
+    job.addr = addr;
+    job.reg = reg;
+    job.buf = buf;
+    job.len = len;
+    job.request = request;
+    
+    return a_async_queue(&job);
+}
+
+/**
+ * @brief     interface non-blocking iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @param[in] *request pointer to the max30205 async request that owns the transfer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the worker thread runs the transfer and the completion
+ */
+uint8_t max30205_interface_iic_write_async(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                                           max30205_async_request_t *request)
+{
+    async_job_t job;
+    
+    memset(&job, 0, sizeof(async_job_t));
+    job.type = ASYNC_JOB_WRITE;
+    job.addr = addr;
+    job.reg = reg;
+    job.buf = buf;
+    job.len = len;
+    job.request = request;
+    
+    return a_async_queue(&job);
+}
+
+/**
+ * @brief     interface one-shot timer start
+ * @param[in] ms timer period
+ * @param[in] *request pointer to the max30205 async request that owns the timer
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the worker thread completes the request when the timer is due and serves the
+ *            other transfers meanwhile
+ */
+uint8_t max30205_interface_timer_start(uint32_t ms, max30205_async_request_t *request)
+{
+    async_job_t job;
+    
+    memset(&job, 0, sizeof(async_job_t));
+    job.type = ASYNC_JOB_TIMER;
+    job.due_us = max30205_interface_timestamp_us() + (uint64_t)ms * 1000;
+    job.request = request;
+    
+    return a_async_queue(&job);
+}
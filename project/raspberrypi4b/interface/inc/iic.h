@@ -74,6 +74,26 @@ uint8_t iic_init(char *name, int *fd);
  */
 uint8_t iic_deinit(int fd);
 
+/**
+ * @brief     iic bus set timeout
+ * @param[in] fd iic handle
+ * @param[in] timeout_us transfer timeout in microseconds
+ * @return    status code
+ *            - 0 success
+ *            - 1 set timeout failed
+ * @note      the adapter counts in 10 ms steps, so the timeout is rounded up to the next step
+ */
+uint8_t iic_set_timeout(int fd, uint32_t timeout_us);
+
+/**
+ * @brief     iic bus get timeout
+ * @param[in] fd iic handle
+ * @return    transfer timeout in microseconds
+ * @note      the kernel cannot read the adapter timeout back, so it is the last timeout set by
+ *            this process or the one second i2c-core default
+ */
+uint32_t iic_get_timeout(int fd);
+
 /**
  * @brief      iic bus read command
  * @param[in]  fd iic handle
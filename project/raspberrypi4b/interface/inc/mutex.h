@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      mutex.h
+ * @brief     mutex header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef MUTEX_H
+#define MUTEX_H
+
+#include <stdint.h>
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup mutex mutex function
+ * @brief    mutex function modules
+ * @{
+ */
+
+/**
+ * @brief mutex handle structure definition
+ */
+typedef struct mutex_handle_s
+{
+    pthread_mutex_t mutex;        /**< pthread mutex */
+    pthread_cond_t cond;          /**< pthread condition */
+} mutex_handle_t;
+
+/**
+ * @brief     mutex init
+ * @param[in] *handle pointer to a mutex handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t mutex_init(mutex_handle_t *handle);
+
+/**
+ * @brief     mutex deinit
+ * @param[in] *handle pointer to a mutex handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t mutex_deinit(mutex_handle_t *handle);
+
+/**
+ * @brief     mutex lock
+ * @param[in] *handle pointer to a mutex handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ * @note      none
+ */
+uint8_t mutex_lock(void *handle);
+
+/**
+ * @brief     mutex unlock
+ * @param[in] *handle pointer to a mutex handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 unlock failed
+ * @note      none
+ */
+uint8_t mutex_unlock(void *handle);
+
+/**
+ * @brief     mutex wait
+ * @param[in] *handle pointer to a mutex handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 wait failed
+ * @note      the mutex must be locked, it is released while waiting and locked again before return
+ */
+uint8_t mutex_wait(void *handle);
+
+/**
+ * @brief     mutex notify
+ * @param[in] *handle pointer to a mutex handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 notify failed
+ * @note      wake all waiters
+ */
+uint8_t mutex_notify(void *handle);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -40,6 +40,13 @@
 #include <sys/ioctl.h>
 #include <fcntl.h>
 
+/**
+ * @brief iic timeout definition
+ */
+#define IIC_TIMEOUT_DEFAULT_US        1000000        /**< i2c-core adapter timeout, one second */
+
+static uint32_t gs_timeout_us = IIC_TIMEOUT_DEFAULT_US;        /**< last adapter timeout */
+
 /**
  * @brief      iic bus init
  * @param[in]  *name pointer to an iic device name buffer
@@ -90,6 +97,52 @@ uint8_t iic_deinit(int fd)
     }
 }
 
+/**
+ * @brief     iic bus set timeout
+ * @param[in] fd iic handle
+ * @param[in] timeout_us transfer timeout in microseconds
+ * @return    status code
+ *            - 0 success
+ *            - 1 set timeout failed
+ * @note      the adapter counts in 10 ms steps, so the timeout is rounded up to the next step
+ */
+uint8_t iic_set_timeout(int fd, uint32_t timeout_us)
+{
+    unsigned long ticks;
+    
+    /* round up to 10 ms steps */
+    ticks = ((unsigned long)timeout_us + 9999UL) / 10000UL;
+    if (ticks == 0)
+    {
+        ticks = 1;
+    }
+    
+    /* set the adapter timeout */
+    if (ioctl(fd, I2C_TIMEOUT, ticks) < 0)
+    {
+        perror("iic: set timeout failed.\n");
+        
+        return 1;
+    }
+    gs_timeout_us = timeout_us;
+    
+    return 0;
+}
+
+/**
+ * @brief     iic bus get timeout
+ * @param[in] fd iic handle
+ * @return    transfer timeout in microseconds
+ * @note      the kernel cannot read the adapter timeout back, so it is the last timeout set by
+ *            this process or the one second i2c-core default
+ */
+uint32_t iic_get_timeout(int fd)
+{
+    (void)fd;
+    
+    return gs_timeout_us;
+}
+
 /**
  * @brief      iic bus read command
  * @param[in]  fd iic handle
@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      mutex.c
+ * @brief     mutex source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "mutex.h"
+
+/**
+ * @brief     mutex init
+ * @param[in] *handle pointer to a mutex handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t mutex_init(mutex_handle_t *handle)
+{
+    /* init the mutex */
+    if (pthread_mutex_init(&handle->mutex, NULL) != 0)
+    {
+        return 1;
+    }
+    
+    /* init the condition */
+    if (pthread_cond_init(&handle->cond, NULL) != 0)
+    {
+        (void)pthread_mutex_destroy(&handle->mutex);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     mutex deinit
+ * @param[in] *handle pointer to a mutex handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t mutex_deinit(mutex_handle_t *handle)
+{
+    /* destroy the condition */
+    if (pthread_cond_destroy(&handle->cond) != 0)
+    {
+        return 1;
+    }
+    
+    /* destroy the mutex */
+    if (pthread_mutex_destroy(&handle->mutex) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     mutex lock
+ * @param[in] *handle pointer to a mutex handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ * @note      none
+ */
+uint8_t mutex_lock(void *handle)
+{
+    mutex_handle_t *p = (mutex_handle_t *)handle;
+    
+    /* lock */
+    if (pthread_mutex_lock(&p->mutex) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     mutex unlock
+ * @param[in] *handle pointer to a mutex handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 unlock failed
+ * @note      none
+ */
+uint8_t mutex_unlock(void *handle)
+{
+    mutex_handle_t *p = (mutex_handle_t *)handle;
+    
+    /* unlock */
+    if (pthread_mutex_unlock(&p->mutex) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     mutex wait
+ * @param[in] *handle pointer to a mutex handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 wait failed
+ * @note      the mutex must be locked, it is released while waiting and locked again before return
+ */
+uint8_t mutex_wait(void *handle)
+{
+    mutex_handle_t *p = (mutex_handle_t *)handle;
+    
+    /* wait for the condition */
+    if (pthread_cond_wait(&p->cond, &p->mutex) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     mutex notify
+ * @param[in] *handle pointer to a mutex handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 notify failed
+ * @note      wake all waiters
+ */
+uint8_t mutex_notify(void *handle)
+{
+    mutex_handle_t *p = (mutex_handle_t *)handle;
+    
+    /* wake all waiters */
+    if (pthread_cond_broadcast(&p->cond) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
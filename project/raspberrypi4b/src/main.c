@@ -40,11 +40,27 @@
 #include "driver_max30205_register_test.h"
 #include "driver_max30205_read_test.h"
 #include "driver_max30205_interrupt_test.h"
+#include "driver_max30205_coalesce_test.h"
+#include "driver_max30205_tdma_test.h"
+#include "driver_max30205_budget_test.h"
+#include "driver_max30205_health_test.h"
+#include "driver_max30205_restore_test.h"
+#include "driver_max30205_scan.h"
+#include "raspberrypi4b_driver_max30205_acquire.h"
+#include "raspberrypi4b_driver_max30205_arbiter_test.h"
+#include "raspberrypi4b_driver_max30205_async_test.h"
+#include "raspberrypi4b_driver_max30205_coroutine_test.h"
+#include "raspberrypi4b_driver_max30205_bus.h"
 #include "gpio.h"
 #include <getopt.h>
 #include <stdlib.h>
 
 volatile uint8_t g_flag;           /**< interrupt flag */
+static max30205_handle_t gs_handle;        /**< max30205 handle */
+static max30205_scan_t gs_scan;            /**< max30205 scan result */
+#if (MAX30205_CONFIG_SHARED_OPS == 1)
+static max30205_linux_bus_t gs_bus;        /**< max30205 linux iic bus */
+#endif
 
 /**
  * @brief     max30205 full function
@@ -60,12 +76,13 @@ uint8_t max30205(uint8_t argc, char **argv)
 {
     int c;
     int longindex = 0;
-    const char short_options[] = "hipe:t:";
+    const char short_options[] = "hipse:t:";
     const struct option long_options[] =
     {
         {"help", no_argument, NULL, 'h'},
         {"information", no_argument, NULL, 'i'},
         {"port", no_argument, NULL, 'p'},
+        {"scan", no_argument, NULL, 's'},
         {"example", required_argument, NULL, 'e'},
         {"test", required_argument, NULL, 't'},
         {"addr", required_argument, NULL, 1},
@@ -73,6 +90,13 @@ uint8_t max30205(uint8_t argc, char **argv)
         {"low-threshold", required_argument, NULL, 3},
         {"mode", required_argument, NULL, 4},
         {"times", required_argument, NULL, 5},
+#if (MAX30205_CONFIG_SHARED_OPS == 1)
+        {"period", required_argument, NULL, 6},
+        {"priority", required_argument, NULL, 7},
+        {"cpu", required_argument, NULL, 8},
+        {"cycles", required_argument, NULL, 9},
+        {"bus", required_argument, NULL, 10},
+#endif
         {NULL, 0, NULL, 0},
     };
     char type[33] = "unknown";
@@ -81,6 +105,13 @@ uint8_t max30205(uint8_t argc, char **argv)
     max30205_interrupt_mode_t mode = MAX30205_INTERRUPT_MODE_COMPARATOR;
     float high_threshold = 39.0f;
     float low_threshold = 35.0f;
+#if (MAX30205_CONFIG_SHARED_OPS == 1)
+    uint32_t period = 1000;
+    int priority = 0;
+    int cpu = -1;
+    uint32_t cycles = 10000;
+    uint8_t bus = 1;
+#endif
     
     /* if no params */
     if (argc == 1)
@@ -131,6 +162,16 @@ uint8_t max30205(uint8_t argc, char **argv)
                 break;
             }
             
+            /* scan */
+            case 's' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "s");
+                
+                break;
+            }
+            
             /* example */
             case 'e' :
             {
@@ -358,6 +399,53 @@ uint8_t max30205(uint8_t argc, char **argv)
                 break;
             } 
             
+#if (MAX30205_CONFIG_SHARED_OPS == 1)
+            /* jitter period */
+            case 6 :
+            {
+                /* set the period */
+                period = atol(optarg);
+                
+                break;
+            }
+            
+            /* real-time priority */
+            case 7 :
+            {
+                /* set the priority */
+                priority = atoi(optarg);
+                
+                break;
+            }
+            
+            /* cpu */
+            case 8 :
+            {
+                /* set the cpu */
+                cpu = atoi(optarg);
+                
+                break;
+            }
+            
+            /* jitter cycles */
+            case 9 :
+            {
+                /* set the cycles */
+                cycles = atol(optarg);
+                
+                break;
+            }
+            
+            /* iic bus */
+            case 10 :
+            {
+                /* set the bus */
+                bus = (uint8_t)atoi(optarg);
+                
+                break;
+            }
+#endif
+            
             /* the end */
             case -1 :
             {
@@ -422,10 +510,162 @@ uint8_t max30205(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("t_coalesce", type) == 0)
+    {
+        /* run coalesce test */
+        if (max30205_coalesce_test(addr) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_tdma", type) == 0)
+    {
+        /* run tdma test */
+        if (max30205_tdma_test(addr) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_budget", type) == 0)
+    {
+        /* run budget test */
+        if (max30205_budget_test(addr) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_health", type) == 0)
+    {
+        /* run health test */
+        if (max30205_health_test(addr) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_restore", type) == 0)
+    {
+        /* run restore test */
+        if (max30205_restore_test(addr) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_arbiter", type) == 0)
+    {
+        /* run arbiter test */
+        if (max30205_arbiter_test(addr) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_async", type) == 0)
+    {
+        /* run async test */
+        if (max30205_async_test(addr) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_coroutine", type) == 0)
+    {
+        /* run coroutine test */
+        if (max30205_coroutine_test(addr) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+#if (MAX30205_CONFIG_SHARED_OPS == 1)
+    else if (strcmp("t_jitter", type) == 0)
+    {
+        uint8_t res;
+        max30205_acquire_latency_t latency;
+        
+        /* link the linux iic bus */
+        (void)max30205_linux_bus_bind(&gs_bus, bus);
+        DRIVER_MAX30205_LINK_INIT(&gs_handle, max30205_handle_t);
+        DRIVER_MAX30205_LINK_BUS(&gs_handle, max30205_linux_bus_get(&gs_bus));
+        
+        /* init and start the continuous read */
+        if (max30205_set_addr_pin(&gs_handle, addr) != 0)
+        {
+            return 1;
+        }
+        if (max30205_init(&gs_handle) != 0)
+        {
+            return 1;
+        }
+        if (max30205_start_continuous_read(&gs_handle) != 0)
+        {
+            (void)max30205_deinit(&gs_handle);
+            
+            return 1;
+        }
+        max30205_interface_delay_ms(100);
+        
+        /* run the benchmark, nothing is printed until it ends */
+        max30205_interface_debug_print("max30205: jitter benchmark with %d cycles of %dus.\n", (uint32_t)cycles, (uint32_t)period);
+        res = max30205_acquire_benchmark(&gs_handle, period, cycles, priority, cpu, &latency);
+        (void)max30205_stop_continuous_read(&gs_handle);
+        (void)max30205_deinit(&gs_handle);
+        if (res == 5)
+        {
+            max30205_interface_debug_print("max30205: real-time setup failed.\n");
+            
+            return 1;
+        }
+        else if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* output */
+        max30205_interface_debug_print("max30205: policy is %s, priority is %d, cpu is %d.\n",
+                                       (priority != 0) ? "SCHED_FIFO" : "SCHED_OTHER", priority, cpu);
+        max30205_interface_debug_print("max30205: cycle latency p50 is %dus.\n", latency.p50_us);
+        max30205_interface_debug_print("max30205: cycle latency p99 is %dus.\n", latency.p99_us);
+        max30205_interface_debug_print("max30205: cycle latency p99.9 is %dus.\n", latency.p999_us);
+        max30205_interface_debug_print("max30205: cycle latency max is %dus.\n", latency.max_us);
+        
+        return 0;
+    }
+#endif
     else if (strcmp("e_read", type) == 0)
     {
         uint8_t res;
         uint32_t i;
+        max30205_periodic_stats_t stats;
         float s;
 
         /* basic init */
@@ -438,11 +678,8 @@ uint8_t max30205(uint8_t argc, char **argv)
         /* loop */
         for (i = 0; i < times; i++)
         {
-            /* delay 1000ms */
-            max30205_interface_delay_ms(1000);
-            
-            /* read data */
-            res = max30205_basic_read((float *)&s);
+            /* wait for the next deadline and read data */
+            res = max30205_basic_periodic_read((float *)&s);
             if (res != 0)
             {
                 (void)max30205_basic_deinit();
@@ -455,6 +692,13 @@ uint8_t max30205(uint8_t argc, char **argv)
             max30205_interface_debug_print("max30205: temperature is %0.3fC.\n", s);
         }
         
+        /* output the statistics */
+        (void)max30205_basic_periodic_stats(&stats);
+        max30205_interface_debug_print("max30205: %d samples, %d overruns, %d skipped.\n",
+                                       stats.samples, stats.overruns, stats.skipped);
+        max30205_interface_debug_print("max30205: jitter min %dus max %dus mean %0.1fus.\n",
+                                       stats.jitter_min_us, stats.jitter_max_us, stats.jitter_mean_us);
+        
         /* basic deinit */
         (void)max30205_basic_deinit();
         
@@ -464,6 +708,7 @@ uint8_t max30205(uint8_t argc, char **argv)
     {
         uint8_t res;
         uint32_t i;
+        max30205_periodic_stats_t stats;
         float s;
         
         /* shot init */
@@ -476,11 +721,8 @@ uint8_t max30205(uint8_t argc, char **argv)
         /* loop */
         for (i = 0; i < times; i++)
         {
-            /* delay 1000ms */
-            max30205_interface_delay_ms(1000);
-            
-            /* read data */
-            res = max30205_shot_read((float *)&s);
+            /* wait for the next deadline and read data */
+            res = max30205_shot_periodic_read((float *)&s);
             if (res != 0)
             {
                 (void)max30205_shot_deinit();
@@ -493,6 +735,13 @@ uint8_t max30205(uint8_t argc, char **argv)
             max30205_interface_debug_print("max30205: temperature is %0.3fC.\n", s);
         }
         
+        /* output the statistics */
+        (void)max30205_shot_periodic_stats(&stats);
+        max30205_interface_debug_print("max30205: %d samples, %d overruns, %d skipped.\n",
+                                       stats.samples, stats.overruns, stats.skipped);
+        max30205_interface_debug_print("max30205: jitter min %dus max %dus mean %0.1fus.\n",
+                                       stats.jitter_min_us, stats.jitter_max_us, stats.jitter_mean_us);
+        
         /* shot deinit */
         (void)max30205_shot_deinit();
         
@@ -502,6 +751,7 @@ uint8_t max30205(uint8_t argc, char **argv)
     {
         uint8_t res;
         uint32_t i;
+        max30205_periodic_stats_t stats;
         float s;
         
         /* gpio init */
@@ -524,11 +774,8 @@ uint8_t max30205(uint8_t argc, char **argv)
         g_flag = 0;
         for (i = 0; i < times; i++)
         {
-            /* delay 1000ms */
-            max30205_interface_delay_ms(1000);
-            
-            /* read data */
-            res = max30205_interrupt_read((float *)&s); 
+            /* wait for the next deadline and read data */
+            res = max30205_interrupt_periodic_read((float *)&s); 
             if (res != 0)
             {
                 (void)gpio_interrupt_deinit();
@@ -550,6 +797,13 @@ uint8_t max30205(uint8_t argc, char **argv)
             max30205_interface_debug_print("max30205: temperature is %0.3fC.\n", s);
         }
         
+        /* output the statistics */
+        (void)max30205_interrupt_periodic_stats(&stats);
+        max30205_interface_debug_print("max30205: %d samples, %d overruns, %d skipped.\n",
+                                       stats.samples, stats.overruns, stats.skipped);
+        max30205_interface_debug_print("max30205: jitter min %dus max %dus mean %0.1fus.\n",
+                                       stats.jitter_min_us, stats.jitter_max_us, stats.jitter_mean_us);
+        
         /* deinit */
         (void)gpio_interrupt_deinit();
         (void)max30205_interrupt_deinit();
@@ -563,10 +817,23 @@ uint8_t max30205(uint8_t argc, char **argv)
         max30205_interface_debug_print("  max30205 (-i | --information)\n");
         max30205_interface_debug_print("  max30205 (-h | --help)\n");
         max30205_interface_debug_print("  max30205 (-p | --port)\n");
+        max30205_interface_debug_print("  max30205 (-s | --scan)\n");
         max30205_interface_debug_print("  max30205 (-t reg | --test=reg) [--addr=<address>]\n");
         max30205_interface_debug_print("  max30205 (-t read | --test=read) [--addr=<address>] [--times=<num>]\n");
         max30205_interface_debug_print("  max30205 (-t int | --test=int) [--addr=<address>] [--times=<num>]\n");
         max30205_interface_debug_print("           [--mode=<INT | CMP>] [--low-threshold=<low>] [--high-threshold=<high>]\n");
+        max30205_interface_debug_print("  max30205 (-t coalesce | --test=coalesce) [--addr=<address>]\n");
+        max30205_interface_debug_print("  max30205 (-t tdma | --test=tdma) [--addr=<address>]\n");
+        max30205_interface_debug_print("  max30205 (-t budget | --test=budget) [--addr=<address>]\n");
+        max30205_interface_debug_print("  max30205 (-t health | --test=health) [--addr=<address>]\n");
+        max30205_interface_debug_print("  max30205 (-t restore | --test=restore) [--addr=<address>]\n");
+        max30205_interface_debug_print("  max30205 (-t arbiter | --test=arbiter) [--addr=<address>]\n");
+        max30205_interface_debug_print("  max30205 (-t async | --test=async) [--addr=<address>]\n");
+        max30205_interface_debug_print("  max30205 (-t coroutine | --test=coroutine) [--addr=<address>]\n");
+#if (MAX30205_CONFIG_SHARED_OPS == 1)
+        max30205_interface_debug_print("  max30205 (-t jitter | --test=jitter) [--addr=<address>] [--bus=<num>] [--cycles=<num>]\n");
+        max30205_interface_debug_print("           [--period=<us>] [--priority=<prio>] [--cpu=<cpu>]\n");
+#endif
         max30205_interface_debug_print("  max30205 (-e read | --example=read) [--addr=<address>] [--times=<num>]\n");
         max30205_interface_debug_print("  max30205 (-e shot | --example=shot) [--addr=<address>] [--times=<num>]\n");
         max30205_interface_debug_print("  max30205 (-e int | --example=int) [--addr=<address>] [--times=<num>]\n");
@@ -574,15 +841,33 @@ uint8_t max30205(uint8_t argc, char **argv)
         max30205_interface_debug_print("\n");
         max30205_interface_debug_print("Options:\n");
         max30205_interface_debug_print("      --addr=<address>           Set the addr pin and it can be \"00\" - \"1F\".([default: 00])\n");
+#if (MAX30205_CONFIG_SHARED_OPS == 1)
+        max30205_interface_debug_print("      --bus=<num>                Set the /dev/i2c-N adapter of the jitter benchmark.([default: 1])\n");
+#endif
         max30205_interface_debug_print("  -e <read | shot | int>, --example=<read | shot | int>\n");
         max30205_interface_debug_print("                                 Run the driver example.\n");
+#if (MAX30205_CONFIG_SHARED_OPS == 1)
+        max30205_interface_debug_print("      --cpu=<cpu>                Pin the jitter benchmark worker on a cpu, -1 for none.([default: -1])\n");
+        max30205_interface_debug_print("      --cycles=<num>             Set the jitter benchmark cycles.([default: 10000])\n");
+#endif
         max30205_interface_debug_print("  -h, --help                     Show the help.\n");
         max30205_interface_debug_print("      --high-threshold=<high>    Set the interrupt high threshold.([default: 39.0f])\n");
         max30205_interface_debug_print("  -i, --information              Show the chip information.\n");
         max30205_interface_debug_print("      --low-threshold=<low>      Set the interrupt low threshold.([default: 35.0f])\n");
         max30205_interface_debug_print("      --mode=<INT | CMP>         Set the interrupt mode.([default: CMP])\n");
         max30205_interface_debug_print("  -p, --port                     Display the pin connections of the current board.\n");
-        max30205_interface_debug_print("  -t <reg | read | int>, --test=<reg | read | int>\n");
+#if (MAX30205_CONFIG_SHARED_OPS == 1)
+        max30205_interface_debug_print("      --period=<us>              Set the jitter benchmark period, 0 for free running.([default: 1000])\n");
+        max30205_interface_debug_print("      --priority=<prio>          Set the SCHED_FIFO priority, 0 disables the real-time mode.([default: 0])\n");
+#endif
+        max30205_interface_debug_print("  -s, --scan                     Scan the bus and list the max30205 devices.\n");
+#if (MAX30205_CONFIG_SHARED_OPS == 1)
+        max30205_interface_debug_print("  -t <reg | read | int | coalesce | tdma | budget | health | restore | arbiter | async | coroutine | jitter>,\n");
+        max30205_interface_debug_print("      --test=<reg | read | int | coalesce | tdma | budget | health | restore | arbiter | async | coroutine | jitter>\n");
+#else
+        max30205_interface_debug_print("  -t <reg | read | int | coalesce | tdma | budget | health | restore | arbiter | async | coroutine>,\n");
+        max30205_interface_debug_print("      --test=<reg | read | int | coalesce | tdma | budget | health | restore | arbiter | async | coroutine>\n");
+#endif
         max30205_interface_debug_print("                                 Run the driver test.\n");
         max30205_interface_debug_print("      --times=<num>              Set the running times.([default: 3])\n");
         
@@ -606,6 +891,53 @@ uint8_t max30205(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("s", type) == 0)
+    {
+        uint8_t res;
+        uint8_t i;
+        uint64_t start;
+        uint64_t cost;
+        
+        /* link interface function */
+        DRIVER_MAX30205_LINK_INIT(&gs_handle, max30205_handle_t);
+        DRIVER_MAX30205_LINK_IIC_INIT(&gs_handle, max30205_interface_iic_init);
+        DRIVER_MAX30205_LINK_IIC_DEINIT(&gs_handle, max30205_interface_iic_deinit);
+        DRIVER_MAX30205_LINK_IIC_READ(&gs_handle, max30205_interface_iic_read);
+        DRIVER_MAX30205_LINK_IIC_WRITE(&gs_handle, max30205_interface_iic_write);
+        DRIVER_MAX30205_LINK_DELAY_MS(&gs_handle, max30205_interface_delay_ms);
+        DRIVER_MAX30205_LINK_DEBUG_PRINT(&gs_handle, max30205_interface_debug_print);
+        DRIVER_MAX30205_LINK_TIMESTAMP_US(&gs_handle, max30205_interface_timestamp_us);
+        
+        /* init the bus */
+        if (max30205_init(&gs_handle) != 0)
+        {
+            return 1;
+        }
+        
+        /* scan */
+        start = max30205_interface_timestamp_us();
+        res = max30205_scan(&gs_handle, &gs_scan, 0, 0);
+        cost = max30205_interface_timestamp_us() - start;
+        
+        /* the devices keep running, only the bus is closed */
+        (void)max30205_interface_iic_deinit();
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* output */
+        for (i = 0; i < gs_scan.num; i++)
+        {
+            max30205_interface_debug_print("max30205: found addr %02X at 0x%02X%s.\n", gs_scan.device[i].pin,
+                                           (uint8_t)gs_scan.device[i].addr_pin,
+                                           (gs_scan.device[i].por != 0) ? " with reset values" : "");
+        }
+        max30205_interface_debug_print("max30205: %d found, %d rejected, %d transactions in %dus.\n",
+                                       gs_scan.num, gs_scan.rejected, gs_scan.transactions, (uint32_t)cost);
+        
+        return 0;
+    }
     else if (strcmp("p", type) == 0)
     {
         /* print pin connection */
@@ -41,6 +41,10 @@
 #include "uart.h"
 #include <stdarg.h>
 
+/**< cycle counter enabled flag */
+static uint32_t gs_timestamp_last = 0;          /**< last cycle counter value */
+static uint64_t gs_timestamp_cycles = 0;        /**< extended cycle count */
+
 /**
  * @brief  interface iic bus init
  * @return status code
@@ -126,3 +130,142 @@ void max30205_interface_debug_print(const char *const fmt, ...)
     len = strlen((char *)str);
     (void)uart_write((uint8_t *)str, len);
 }
+
+/**
+ * @brief  interface timestamp us
+ * @return monotonic time in microseconds
+ * @note   it reads the dwt cycle counter that the systick interrupt extends to 64 bits
+ */
+uint64_t max30205_interface_timestamp_us(void)
+{
+    return delay_timestamp_us();
+}
+
+/**
+ * @brief     interface sleep until
+ * @param[in] deadline_us absolute time on the max30205_interface_timestamp_us clock
+ * @note      it sleeps between the 1 ms hal tick interrupts and spins the last millisecond
+ */
+void max30205_interface_sleep_until_us(uint64_t deadline_us)
+{
+    uint64_t now;
+    
+    while (1)
+    {
+        now = max30205_interface_timestamp_us();
+        if (now >= deadline_us)
+        {
+            break;
+        }
+        
+        /* wait for the next tick while far away */
+        if (deadline_us - now > 1000)
+        {
+            __WFI();
+        }
+    }
+}
+
+/**
+ * @brief      interface iic bus read with a timeout
+ * @param[in]  *ctx pointer to a bus context
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  timeout_us time after which the read gives up
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       timeout_us is ignored, the bit-banged transfer is only bounded by its ack timeout and
+ *             the deadline reader drops a late result
+ */
+uint8_t max30205_interface_iic_read_timeout(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf,
+                                            uint16_t len, uint32_t timeout_us)
+{
+    (void)ctx;
+    (void)timeout_us;
+    
+    return iic_read(addr, reg, buf, len);
+}
+
+/**
+ * @brief     interface iic bus write with a timeout
+ * @param[in] *ctx pointer to a bus context
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @param[in] timeout_us time after which the write gives up
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      timeout_us is ignored, the bit-banged transfer is only bounded by its ack timeout and
+ *            the deadline reader drops a late result
+ */
+uint8_t max30205_interface_iic_write_timeout(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf,
+                                             uint16_t len, uint32_t timeout_us)
+{
+    (void)ctx;
+    (void)timeout_us;
+    
+    return iic_write(addr, reg, buf, len);
+}
+
+/**
+ * @brief      interface non-blocking iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  *request pointer to the max30205 async request that owns the transfer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the bit-banged bus has no dma, so the read runs blocking and completes before returning
+ */
+uint8_t max30205_interface_iic_read_async(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                                          max30205_async_request_t *request)
+{
+    (void)max30205_async_complete(request, iic_read(addr, reg, buf, len));
+    
+    return 0;
+}
+
+/**
+ * @brief     interface non-blocking iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @param[in] *request pointer to the max30205 async request that owns the transfer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the bit-banged bus has no dma, so the write runs blocking and completes before returning
+ */
+uint8_t max30205_interface_iic_write_async(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                                           max30205_async_request_t *request)
+{
+    (void)max30205_async_complete(request, iic_write(addr, reg, buf, len));
+    
+    return 0;
+}
+
+/**
+ * @brief     interface one-shot timer start
+ * @param[in] ms timer period
+ * @param[in] *request pointer to the max30205 async request that owns the timer
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      it waits on the hal tick, completing from the systick interrupt would run the following
+ *            bit-banged read inside the interrupt
+ */
+uint8_t max30205_interface_timer_start(uint32_t ms, max30205_async_request_t *request)
+{
+    delay_ms(ms);
+    (void)max30205_async_complete(request, 0);
+    
+    return 0;
+}
@@ -71,6 +71,19 @@ void delay_us(uint32_t us);
  */
 void delay_ms(uint32_t ms);
 
+/**
+ * @brief  delay timestamp us
+ * @return monotonic time in microseconds
+ * @note   none
+ */
+uint64_t delay_timestamp_us(void);
+
+/**
+ * @brief delay timestamp update
+ * @note  call it from the systick interrupt
+ */
+void delay_timestamp_update(void);
+
 /**
  * @}
  */
@@ -37,6 +37,9 @@
 #include "delay.h"
 
 static volatile uint32_t gs_fac_us = 0;        /**< fac cnt */
+static volatile uint32_t gs_stamp_last = 0;    /**< last cycle counter value */
+static volatile uint64_t gs_stamp_cycles = 0;  /**< extended cycle count */
+static volatile uint32_t gs_stamp_seq = 0;     /**< extension sequence */
 
 /**
  * @brief  delay clock init
@@ -52,6 +55,13 @@ uint8_t delay_init(void)
     /* set fac */
     gs_fac_us = 168;
     
+    /* enable the cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    gs_stamp_last = 0;
+    gs_stamp_cycles = 0;
+    
     return 0;
 }
 
@@ -107,3 +117,42 @@ void delay_ms(uint32_t ms)
     /* use the hal delay */
     HAL_Delay(ms);
 }
+
+/**
+ * @brief  delay timestamp us
+ * @return monotonic time in microseconds
+ * @note   it scales the extended dwt cycle count by SystemCoreClock
+ */
+uint64_t delay_timestamp_us(void)
+{
+    uint32_t seq;
+    uint32_t last;
+    uint32_t now;
+    uint64_t cycles;
+    
+    /* retry when the systick extended the count meanwhile */
+    do
+    {
+        seq = gs_stamp_seq;
+        cycles = gs_stamp_cycles;
+        last = gs_stamp_last;
+        now = DWT->CYCCNT;
+    } while (seq != gs_stamp_seq);
+    
+    return (cycles + (uint32_t)(now - last)) / (SystemCoreClock / 1000000);
+}
+
+/**
+ * @brief delay timestamp update
+ * @note  it extends the 32 bit cycle counter to 64 bits and is called from the 1 ms systick
+ *        interrupt, which is the only writer of the extended count
+ */
+void delay_timestamp_update(void)
+{
+    uint32_t now;
+    
+    now = DWT->CYCCNT;
+    gs_stamp_cycles += (uint32_t)(now - gs_stamp_last);
+    gs_stamp_last = now;
+    gs_stamp_seq++;
+}
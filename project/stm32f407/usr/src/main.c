@@ -40,6 +40,12 @@
 #include "driver_max30205_register_test.h"
 #include "driver_max30205_read_test.h"
 #include "driver_max30205_interrupt_test.h"
+#include "driver_max30205_coalesce_test.h"
+#include "driver_max30205_tdma_test.h"
+#include "driver_max30205_budget_test.h"
+#include "driver_max30205_health_test.h"
+#include "driver_max30205_restore_test.h"
+#include "driver_max30205_scan.h"
 #include "shell.h"
 #include "clock.h"
 #include "delay.h"
@@ -54,6 +60,8 @@
 uint8_t g_buf[256];        /**< uart buffer */
 volatile uint16_t g_len;   /**< uart buffer length */
 volatile uint8_t g_flag;   /**< interrupt flag */
+static max30205_handle_t gs_handle;        /**< max30205 handle */
+static max30205_scan_t gs_scan;            /**< max30205 scan result */
 
 /**
  * @brief exti 0 irq
@@ -91,12 +99,13 @@ uint8_t max30205(uint8_t argc, char **argv)
 {
     int c;
     int longindex = 0;
-    const char short_options[] = "hipe:t:";
+    const char short_options[] = "hipse:t:";
     const struct option long_options[] =
     {
         {"help", no_argument, NULL, 'h'},
         {"information", no_argument, NULL, 'i'},
         {"port", no_argument, NULL, 'p'},
+        {"scan", no_argument, NULL, 's'},
         {"example", required_argument, NULL, 'e'},
         {"test", required_argument, NULL, 't'},
         {"addr", required_argument, NULL, 1},
@@ -162,6 +171,16 @@ uint8_t max30205(uint8_t argc, char **argv)
                 break;
             }
             
+            /* scan */
+            case 's' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "s");
+                
+                break;
+            }
+            
             /* example */
             case 'e' :
             {
@@ -453,10 +472,71 @@ uint8_t max30205(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("t_coalesce", type) == 0)
+    {
+        /* run coalesce test */
+        if (max30205_coalesce_test(addr) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_tdma", type) == 0)
+    {
+        /* run tdma test */
+        if (max30205_tdma_test(addr) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_budget", type) == 0)
+    {
+        /* run budget test */
+        if (max30205_budget_test(addr) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_health", type) == 0)
+    {
+        /* run health test */
+        if (max30205_health_test(addr) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_restore", type) == 0)
+    {
+        /* run restore test */
+        if (max30205_restore_test(addr) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
     else if (strcmp("e_read", type) == 0)
     {
         uint8_t res;
         uint32_t i;
+        max30205_periodic_stats_t stats;
         float s;
 
         /* basic init */
@@ -469,11 +549,8 @@ uint8_t max30205(uint8_t argc, char **argv)
         /* loop */
         for (i = 0; i < times; i++)
         {
-            /* delay 1000ms */
-            max30205_interface_delay_ms(1000);
-            
-            /* read data */
-            res = max30205_basic_read((float *)&s);
+            /* wait for the next deadline and read data */
+            res = max30205_basic_periodic_read((float *)&s);
             if (res != 0)
             {
                 (void)max30205_basic_deinit();
@@ -486,6 +563,13 @@ uint8_t max30205(uint8_t argc, char **argv)
             max30205_interface_debug_print("max30205: temperature is %0.3fC.\n", s);
         }
         
+        /* output the statistics */
+        (void)max30205_basic_periodic_stats(&stats);
+        max30205_interface_debug_print("max30205: %d samples, %d overruns, %d skipped.\n",
+                                       stats.samples, stats.overruns, stats.skipped);
+        max30205_interface_debug_print("max30205: jitter min %dus max %dus mean %0.1fus.\n",
+                                       stats.jitter_min_us, stats.jitter_max_us, stats.jitter_mean_us);
+        
         /* basic deinit */
         (void)max30205_basic_deinit();
         
@@ -495,6 +579,7 @@ uint8_t max30205(uint8_t argc, char **argv)
     {
         uint8_t res;
         uint32_t i;
+        max30205_periodic_stats_t stats;
         float s;
         
         /* shot init */
@@ -507,11 +592,8 @@ uint8_t max30205(uint8_t argc, char **argv)
         /* loop */
         for (i = 0; i < times; i++)
         {
-            /* delay 1000ms */
-            max30205_interface_delay_ms(1000);
-            
-            /* read data */
-            res = max30205_shot_read((float *)&s);
+            /* wait for the next deadline and read data */
+            res = max30205_shot_periodic_read((float *)&s);
             if (res != 0)
             {
                 (void)max30205_shot_deinit();
@@ -524,6 +606,13 @@ uint8_t max30205(uint8_t argc, char **argv)
             max30205_interface_debug_print("max30205: temperature is %0.3fC.\n", s);
         }
         
+        /* output the statistics */
+        (void)max30205_shot_periodic_stats(&stats);
+        max30205_interface_debug_print("max30205: %d samples, %d overruns, %d skipped.\n",
+                                       stats.samples, stats.overruns, stats.skipped);
+        max30205_interface_debug_print("max30205: jitter min %dus max %dus mean %0.1fus.\n",
+                                       stats.jitter_min_us, stats.jitter_max_us, stats.jitter_mean_us);
+        
         /* shot deinit */
         (void)max30205_shot_deinit();
         
@@ -533,6 +622,7 @@ uint8_t max30205(uint8_t argc, char **argv)
     {
         uint8_t res;
         uint32_t i;
+        max30205_periodic_stats_t stats;
         float s;
         
         /* gpio init */
@@ -555,11 +645,8 @@ uint8_t max30205(uint8_t argc, char **argv)
         g_flag = 0;
         for (i = 0; i < times; i++)
         {
-            /* delay 1000ms */
-            max30205_interface_delay_ms(1000);
-            
-            /* read data */
-            res = max30205_interrupt_read((float *)&s); 
+            /* wait for the next deadline and read data */
+            res = max30205_interrupt_periodic_read((float *)&s); 
             if (res != 0)
             {
                 (void)gpio_interrupt_deinit();
@@ -581,6 +668,13 @@ uint8_t max30205(uint8_t argc, char **argv)
             max30205_interface_debug_print("max30205: temperature is %0.3fC.\n", s);
         }
         
+        /* output the statistics */
+        (void)max30205_interrupt_periodic_stats(&stats);
+        max30205_interface_debug_print("max30205: %d samples, %d overruns, %d skipped.\n",
+                                       stats.samples, stats.overruns, stats.skipped);
+        max30205_interface_debug_print("max30205: jitter min %dus max %dus mean %0.1fus.\n",
+                                       stats.jitter_min_us, stats.jitter_max_us, stats.jitter_mean_us);
+        
         /* deinit */
         (void)gpio_interrupt_deinit();
         (void)max30205_interrupt_deinit();
@@ -594,10 +688,16 @@ uint8_t max30205(uint8_t argc, char **argv)
         max30205_interface_debug_print("  max30205 (-i | --information)\n");
         max30205_interface_debug_print("  max30205 (-h | --help)\n");
         max30205_interface_debug_print("  max30205 (-p | --port)\n");
+        max30205_interface_debug_print("  max30205 (-s | --scan)\n");
         max30205_interface_debug_print("  max30205 (-t reg | --test=reg) [--addr=<address>]\n");
         max30205_interface_debug_print("  max30205 (-t read | --test=read) [--addr=<address>] [--times=<num>]\n");
         max30205_interface_debug_print("  max30205 (-t int | --test=int) [--addr=<address>] [--times=<num>]\n");
         max30205_interface_debug_print("           [--mode=<INT | CMP>] [--low-threshold=<low>] [--high-threshold=<high>]\n");
+        max30205_interface_debug_print("  max30205 (-t coalesce | --test=coalesce) [--addr=<address>]\n");
+        max30205_interface_debug_print("  max30205 (-t tdma | --test=tdma) [--addr=<address>]\n");
+        max30205_interface_debug_print("  max30205 (-t budget | --test=budget) [--addr=<address>]\n");
+        max30205_interface_debug_print("  max30205 (-t health | --test=health) [--addr=<address>]\n");
+        max30205_interface_debug_print("  max30205 (-t restore | --test=restore) [--addr=<address>]\n");
         max30205_interface_debug_print("  max30205 (-e read | --example=read) [--addr=<address>] [--times=<num>]\n");
         max30205_interface_debug_print("  max30205 (-e shot | --example=shot) [--addr=<address>] [--times=<num>]\n");
         max30205_interface_debug_print("  max30205 (-e int | --example=int) [--addr=<address>] [--times=<num>]\n");
@@ -613,7 +713,9 @@ uint8_t max30205(uint8_t argc, char **argv)
         max30205_interface_debug_print("      --low-threshold=<low>      Set the interrupt low threshold.([default: 35.0f])\n");
         max30205_interface_debug_print("      --mode=<INT | CMP>         Set the interrupt mode.([default: CMP])\n");
         max30205_interface_debug_print("  -p, --port                     Display the pin connections of the current board.\n");
-        max30205_interface_debug_print("  -t <reg | read | int>, --test=<reg | read | int>\n");
+        max30205_interface_debug_print("  -s, --scan                     Scan the bus and list the max30205 devices.\n");
+        max30205_interface_debug_print("  -t <reg | read | int | coalesce | tdma | budget | health | restore>,\n");
+        max30205_interface_debug_print("      --test=<reg | read | int | coalesce | tdma | budget | health | restore>\n");
         max30205_interface_debug_print("                                 Run the driver test.\n");
         max30205_interface_debug_print("      --times=<num>              Set the running times.([default: 3])\n");
         
@@ -637,6 +739,53 @@ uint8_t max30205(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("s", type) == 0)
+    {
+        uint8_t res;
+        uint8_t i;
+        uint64_t start;
+        uint64_t cost;
+        
+        /* link interface function */
+        DRIVER_MAX30205_LINK_INIT(&gs_handle, max30205_handle_t);
+        DRIVER_MAX30205_LINK_IIC_INIT(&gs_handle, max30205_interface_iic_init);
+        DRIVER_MAX30205_LINK_IIC_DEINIT(&gs_handle, max30205_interface_iic_deinit);
+        DRIVER_MAX30205_LINK_IIC_READ(&gs_handle, max30205_interface_iic_read);
+        DRIVER_MAX30205_LINK_IIC_WRITE(&gs_handle, max30205_interface_iic_write);
+        DRIVER_MAX30205_LINK_DELAY_MS(&gs_handle, max30205_interface_delay_ms);
+        DRIVER_MAX30205_LINK_DEBUG_PRINT(&gs_handle, max30205_interface_debug_print);
+        DRIVER_MAX30205_LINK_TIMESTAMP_US(&gs_handle, max30205_interface_timestamp_us);
+        
+        /* init the bus */
+        if (max30205_init(&gs_handle) != 0)
+        {
+            return 1;
+        }
+        
+        /* scan */
+        start = max30205_interface_timestamp_us();
+        res = max30205_scan(&gs_handle, &gs_scan, 0, 0);
+        cost = max30205_interface_timestamp_us() - start;
+        
+        /* the devices keep running, only the bus is closed */
+        (void)max30205_interface_iic_deinit();
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* output */
+        for (i = 0; i < gs_scan.num; i++)
+        {
+            max30205_interface_debug_print("max30205: found addr %02X at 0x%02X%s.\n", gs_scan.device[i].pin,
+                                           (uint8_t)gs_scan.device[i].addr_pin,
+                                           (gs_scan.device[i].por != 0) ? " with reset values" : "");
+        }
+        max30205_interface_debug_print("max30205: %d found, %d rejected, %d transactions in %dus.\n",
+                                       gs_scan.num, gs_scan.rejected, gs_scan.transactions, (uint32_t)cost);
+        
+        return 0;
+    }
     else if (strcmp("p", type) == 0)
     {
         /* print pin connection */
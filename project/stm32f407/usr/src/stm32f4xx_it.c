@@ -35,6 +35,7 @@
  */
 
 #include "stm32f4xx_it.h"
+#include "delay.h"
 #include "uart.h"
 
 /**
@@ -144,6 +145,9 @@ void HAL_SYSTICK_Callback(void)
 {
     /* inc tick */
     HAL_IncTick();
+    
+    /* extend the cycle counter */
+    delay_timestamp_update();
 }
 
 /**
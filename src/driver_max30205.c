@@ -57,6 +57,215 @@
 #define MAX30205_REG_THYST        0x02        /**< thyst register */
 #define MAX30205_REG_TOS          0x03        /**< tos register */
 
+#if (MAX30205_CONFIG_SHARED_OPS == 1)
+#include <stdarg.h>
+#include <stdio.h>
+
+/**
+ * @brief classic link print definition
+ */
+#if (MAX30205_CONFIG_DEBUG_PRINT == 1)
+    #define MAX30205_LINK_PRINT(...)    g_max30205_link.debug_print(__VA_ARGS__)
+#else
+    #define MAX30205_LINK_PRINT(...)    ((void)0)
+#endif
+
+/**
+ * @brief classic link variable definition
+ */
+max30205_link_t g_max30205_link;               /**< functions linked with the classic link macros */
+static max30205_link_t gs_link;                /**< functions run by the inited classic handles */
+static uint32_t gs_link_users;                 /**< inited classic handles */
+
+/**
+ * @brief     run the linked iic_init
+ * @param[in] *ctx pointer to the classic link
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      none
+ */
+static uint8_t a_max30205_link_iic_init(void *ctx)
+{
+    return ((max30205_link_t *)ctx)->iic_init();                                /* run iic_init */
+}
+
+/**
+ * @brief     run the linked iic_deinit
+ * @param[in] *ctx pointer to the classic link
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      none
+ */
+static uint8_t a_max30205_link_iic_deinit(void *ctx)
+{
+    return ((max30205_link_t *)ctx)->iic_deinit();                              /* run iic_deinit */
+}
+
+/**
+ * @brief      run the linked iic_read
+ * @param[in]  *ctx pointer to the classic link
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_max30205_link_iic_read(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return ((max30205_link_t *)ctx)->iic_read(addr, reg, buf, len);             /* run iic_read */
+}
+
+/**
+ * @brief     run the linked iic_write
+ * @param[in] *ctx pointer to the classic link
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_max30205_link_iic_write(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return ((max30205_link_t *)ctx)->iic_write(addr, reg, buf, len);            /* run iic_write */
+}
+
+/**
+ * @brief     run the linked delay_ms
+ * @param[in] *ctx pointer to the classic link
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_max30205_link_delay_ms(void *ctx, uint32_t ms)
+{
+    ((max30205_link_t *)ctx)->delay_ms(ms);                                     /* run delay_ms */
+}
+
+/**
+ * @brief     run the linked debug_print
+ * @param[in] fmt format data
+ * @note      the linked function gets the formatted string
+ */
+static void a_max30205_link_debug_print(const char *const fmt, ...)
+{
+    char str[256];
+    va_list args;
+    
+    memset((char *)str, 0, sizeof(char) * 256);                                 /* clear the buffer */
+    va_start(args, fmt);                                                        /* start the args */
+    (void)vsnprintf((char *)str, 255, (char const *)fmt, args);                 /* format the string */
+    va_end(args);                                                               /* end the args */
+    gs_link.debug_print("%s", str);                                             /* run debug_print */
+}
+
+/**
+ * @brief     run the linked timestamp_us
+ * @param[in] *ctx pointer to the classic link
+ * @return    monotonic microsecond counter
+ * @note      an unlinked timestamp_us returns 0
+ */
+static uint64_t a_max30205_link_timestamp_us(void *ctx)
+{
+    if (((max30205_link_t *)ctx)->timestamp_us == NULL)                         /* optional function */
+    {
+        return 0;                                                               /* no clock */
+    }
+    
+    return ((max30205_link_t *)ctx)->timestamp_us();                            /* run timestamp_us */
+}
+
+/**
+ * @brief operation table of the classic link
+ */
+static const max30205_ops_t gs_link_ops =
+{
+    a_max30205_link_iic_init,
+    a_max30205_link_iic_deinit,
+    a_max30205_link_iic_read,
+    a_max30205_link_iic_write,
+    a_max30205_link_delay_ms,
+    a_max30205_link_debug_print,
+    a_max30205_link_timestamp_us,
+};
+
+/**
+ * @brief bus running the classic link functions
+ */
+const max30205_bus_t g_max30205_link_bus =
+{
+    &gs_link_ops,
+    &gs_link,
+};
+
+/**
+ * @brief  take the classic link functions for a handle
+ * @return status code
+ *         - 0 success
+ *         - 3 linked functions is NULL or differ from the inited classic handles
+ * @note   the first classic handle copies the linked functions and every later one must link
+ *         the same functions until all of them are closed, so a later link never changes the
+ *         functions of a running handle, init and deinit the classic handles from one thread
+ */
+static uint8_t a_max30205_link_take(void)
+{
+#if (MAX30205_CONFIG_DEBUG_PRINT == 1)
+    if (g_max30205_link.debug_print == NULL)                                                  /* check debug_print */
+    {
+        return 3;                                                                             /* return error */
+    }
+#endif
+    if (g_max30205_link.iic_init == NULL)                                                     /* check iic_init */
+    {
+        MAX30205_LINK_PRINT("max30205: iic_init is null.\n");                                 /* iic_init is null */
+        
+        return 3;                                                                             /* return error */
+    }
+    if (g_max30205_link.iic_deinit == NULL)                                                   /* check iic_deinit */
+    {
+        MAX30205_LINK_PRINT("max30205: iic_deinit is null.\n");                               /* iic_deinit is null */
+        
+        return 3;                                                                             /* return error */
+    }
+    if (g_max30205_link.iic_read == NULL)                                                     /* check iic_read */
+    {
+        MAX30205_LINK_PRINT("max30205: iic_read is null.\n");                                 /* iic_read is null */
+        
+        return 3;                                                                             /* return error */
+    }
+    if (g_max30205_link.iic_write == NULL)                                                    /* check iic_write */
+    {
+        MAX30205_LINK_PRINT("max30205: iic_write is null.\n");                                /* iic_write is null */
+        
+        return 3;                                                                             /* return error */
+    }
+    if (g_max30205_link.delay_ms == NULL)                                                     /* check delay_ms */
+    {
+        MAX30205_LINK_PRINT("max30205: delay_ms is null.\n");                                 /* delay_ms is null */
+        
+        return 3;                                                                             /* return error */
+    }
+    if (gs_link_users == 0)                                                                   /* no running handle */
+    {
+        memcpy(&gs_link, &g_max30205_link, sizeof(max30205_link_t));                          /* take the functions */
+    }
+    else if (memcmp(&gs_link, &g_max30205_link, sizeof(max30205_link_t)) != 0)                /* mixed functions */
+    {
+        MAX30205_LINK_PRINT("max30205: classic link differs from the inited handles.\n");     /* mixed link */
+        
+        return 3;                                                                             /* return error */
+    }
+    
+    return 0;                                                                                 /* success return 0 */
+}
+#endif
+
 /**
  * @brief     initialize the chip
  * @param[in] *handle pointer to a max30205 handle structure
@@ -69,55 +278,73 @@
  */
 uint8_t max30205_init(max30205_handle_t *handle)
 {
-    if (handle == NULL)                                                /* check handle */
+    if (handle == NULL)                                                         /* check handle */
+    {
+        return 2;                                                               /* return error */
+    }
+#if (MAX30205_CONFIG_SHARED_OPS == 1)
+    if ((handle->bus == NULL) || (handle->bus->ops == NULL))                    /* check bus */
+    {
+        return 3;                                                               /* return error */
+    }
+    if ((handle->bus == &g_max30205_link_bus) && (a_max30205_link_take() != 0)) /* classic link */
     {
-        return 2;                                                      /* return error */
+        return 3;                                                               /* return error */
     }
-    if (handle->debug_print == NULL)                                   /* check debug_print */
+#endif
+#if (MAX30205_CONFIG_DEBUG_PRINT == 1)
+    if (MAX30205_OPS(handle)->debug_print == NULL)                              /* check debug_print */
     {
-        return 3;                                                      /* return error */
+        return 3;                                                               /* return error */
     }
-    if (handle->iic_init == NULL)                                      /* check iic_init */
+#endif
+    if (MAX30205_OPS(handle)->iic_init == NULL)                                 /* check iic_init */
     {
-        handle->debug_print("max30205: iic_init is null.\n");          /* iic_init is null */
+        MAX30205_DEBUG_PRINT(handle, "max30205: iic_init is null.\n");          /* iic_init is null */
         
-        return 3;                                                      /* return error */
+        return 3;                                                               /* return error */
     }
-    if (handle->iic_deinit == NULL)                                    /* check iic_deinit */
+    if (MAX30205_OPS(handle)->iic_deinit == NULL)                               /* check iic_deinit */
     {
-        handle->debug_print("max30205: iic_deinit is null.\n");        /* iic_deinit is null */
+        MAX30205_DEBUG_PRINT(handle, "max30205: iic_deinit is null.\n");        /* iic_deinit is null */
         
-        return 3;                                                      /* return error */
+        return 3;                                                               /* return error */
     }
-    if (handle->iic_read == NULL)                                      /* check iic_read */
+    if (MAX30205_OPS(handle)->iic_read == NULL)                                 /* check iic_read */
     {
-        handle->debug_print("max30205: iic_read is null.\n");          /* iic_read is null */
+        MAX30205_DEBUG_PRINT(handle, "max30205: iic_read is null.\n");          /* iic_read is null */
         
-        return 3;                                                      /* return error */
+        return 3;                                                               /* return error */
     }
-    if (handle->iic_write == NULL)                                     /* check iic_write */
+    if (MAX30205_OPS(handle)->iic_write == NULL)                                /* check iic_write */
     {
-        handle->debug_print("max30205: iic_write is null.\n");         /* iic_write is null */
+        MAX30205_DEBUG_PRINT(handle, "max30205: iic_write is null.\n");         /* iic_write is null */
         
-        return 3;                                                      /* return error */
+        return 3;                                                               /* return error */
     }
-    if (handle->delay_ms == NULL)                                      /* check delay_ms */
+    if (MAX30205_OPS(handle)->delay_ms == NULL)                                 /* check delay_ms */
     {
-        handle->debug_print("max30205: delay_ms is null.\n");          /* delay_ms is null */
+        MAX30205_DEBUG_PRINT(handle, "max30205: delay_ms is null.\n");          /* delay_ms is null */
         
-        return 3;                                                      /* return error */
+        return 3;                                                               /* return error */
     }
 
-    if (handle->iic_init() != 0)                                       /* init iic */
+    if (MAX30205_IIC_INIT(handle) != 0)                                         /* init iic */
     {
-        handle->debug_print("max30205: iic init failed.\n");           /* iic init failed */
+        MAX30205_DEBUG_PRINT(handle, "max30205: iic init failed.\n");           /* iic init failed */
         
-        return 1;                                                      /* return error */
+        return 1;                                                               /* return error */
+    }
+    handle->inited = 1;                                                         /* flag finish initialization */
+    handle->reg = 0;                                                            /* initialize register */
+#if (MAX30205_CONFIG_SHARED_OPS == 1)
+    if (handle->bus == &g_max30205_link_bus)                                    /* classic link */
+    {
+        gs_link_users++;                                                        /* one more classic handle */
     }
-    handle->inited = 1;                                                /* flag finish initialization */
-    handle->reg = 0;                                                   /* initialize register */
+#endif
     
-    return 0;                                                          /* success return 0 */
+    return 0;                                                                   /* success return 0 */
 }
 
 /**
@@ -144,19 +371,25 @@ uint8_t max30205_deinit(max30205_handle_t *handle)
     }
     
     reg = handle->reg | 0x01;                                                              /* power down */
-    if (handle->iic_write(handle->iic_addr, MAX30205_REG_CONF, (uint8_t *)&reg, 1) != 0)   /* write to conf register */
+    if (MAX30205_IIC_WRITE(handle, MAX30205_REG_CONF, (uint8_t *)&reg, 1) != 0)            /* write to conf register */
     {
-        handle->debug_print("max30205: power down failed.\n");                             /* power down failed */
+        MAX30205_DEBUG_PRINT(handle, "max30205: power down failed.\n");                    /* power down failed */
         
         return 1;                                                                          /* return error */
     }
-    if (handle->iic_deinit() != 0)                                                         /* iic deinit */
+    if (MAX30205_IIC_DEINIT(handle) != 0)                                                  /* iic deinit */
     {
-        handle->debug_print("max30205: iic deinit failed.\n");                             /* iic deinit failed */
+        MAX30205_DEBUG_PRINT(handle, "max30205: iic deinit failed.\n");                    /* iic deinit failed */
         
         return 1;                                                                          /* return error */
     }   
     handle->inited = 0;                                                                    /* flag close */
+#if (MAX30205_CONFIG_SHARED_OPS == 1)
+    if ((handle->bus == &g_max30205_link_bus) && (gs_link_users != 0))                     /* classic link */
+    {
+        gs_link_users--;                                                                   /* one less classic handle */
+    }
+#endif
     
     return 0;                                                                              /* success return 0 */
 }
@@ -211,6 +444,7 @@ uint8_t max30205_get_addr_pin(max30205_handle_t *handle, max30205_address_t *add
  *            - 0 success
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
+ *            - 4 extended format is disabled
  * @note      none
  */
 uint8_t max30205_set_data_format(max30205_handle_t *handle, max30205_data_format_t format)
@@ -226,7 +460,11 @@ uint8_t max30205_set_data_format(max30205_handle_t *handle, max30205_data_format
 
     if (format != 0)                                  /* if extended format */
     {
+#if (MAX30205_CONFIG_EXTENDED_FORMAT == 1)
         handle->reg = handle->reg | (1 << 5);         /* set extended format */
+#else
+        return 4;                                     /* return error */
+#endif
     }
     else
     {
@@ -257,11 +495,13 @@ uint8_t max30205_get_data_format(max30205_handle_t *handle, max30205_data_format
         return 3;                                       /* return error */
     }
 
+#if (MAX30205_CONFIG_EXTENDED_FORMAT == 1)
     if ((handle->reg & (1 << 5)) != 0)                  /* get format */
     {
         *format = MAX30205_DATA_FORMAT_EXTENDED;        /* get format extended */
     }
     else
+#endif
     {
         *format = MAX30205_DATA_FORMAT_NORMAL;          /* get format normal */
     }
@@ -546,9 +786,9 @@ uint8_t max30205_start_continuous_read(max30205_handle_t *handle)
     
     reg = handle->reg & (~(1 << 0));                                                          /* exit shutdown mode */
     reg = reg & (~(1 << 7));                                                                  /* set continuous read bit */
-    if (handle->iic_write(handle->iic_addr, MAX30205_REG_CONF, (uint8_t *)&reg, 1) != 0)      /* write conf register */
+    if (MAX30205_IIC_WRITE(handle, MAX30205_REG_CONF, (uint8_t *)&reg, 1) != 0)               /* write conf register */
     {
-        handle->debug_print("max30205: start continuous read failed.\n");                     /* start continuous read failed */
+        MAX30205_DEBUG_PRINT(handle, "max30205: start continuous read failed.\n");            /* start continuous read failed */
         
         return 1;                                                                             /* return error */
     }
@@ -584,9 +824,9 @@ uint8_t max30205_stop_continuous_read(max30205_handle_t *handle)
     reg = handle->reg | (1 << 0);                                                             /* enter shutdown mode */
     reg = reg | (1 << 7);                                                                     /* set continuous read bit */
     
-    if (handle->iic_write(handle->iic_addr, MAX30205_REG_CONF, (uint8_t *)&reg, 1) != 0)      /* write conf register */
+    if (MAX30205_IIC_WRITE(handle, MAX30205_REG_CONF, (uint8_t *)&reg, 1) != 0)               /* write conf register */
     {
-        handle->debug_print("max30205: stop continuous read failed.\n");                      /* stop continuous read failed */
+        MAX30205_DEBUG_PRINT(handle, "max30205: stop continuous read failed.\n");             /* stop continuous read failed */
         
         return 1;                                                                             /* return error */
     }
@@ -623,18 +863,20 @@ uint8_t max30205_continuous_read(max30205_handle_t *handle, int16_t *raw, float
     }
     
     memset(buf, 0, sizeof(uint8_t) * 2);                                                 /* clear the buffer */
-    if (handle->iic_read(handle->iic_addr, MAX30205_REG_TEMP, (uint8_t *)buf, 2) != 0)   /* read two bytes */
+    if (MAX30205_IIC_READ(handle, MAX30205_REG_TEMP, (uint8_t *)buf, 2) != 0)            /* read two bytes */
     {
-        handle->debug_print("max30205: read failed.\n");                                 /* read temp failed */
+        MAX30205_DEBUG_PRINT(handle, "max30205: read failed.\n");                        /* read temp failed */
         
         return 1;                                                                        /* return error */
     }
+#if (MAX30205_CONFIG_EXTENDED_FORMAT == 1)
     if ((handle->reg & (1 << 5)) != 0)                                                   /* extended format */
     {
         *raw = (int16_t)(((uint16_t)buf[0]) << 8 | buf[1]);                              /* get raw data */
         *s = (float)(*raw) * 0.00390625f + 64.0f;                                        /* convert raw data to real data */
     }
     else                                                                                 /* normal format */
+#endif
     {
         *raw = (int16_t)(((uint16_t)buf[0]) << 8 | buf[1]);                              /* get raw data */
         *s = (float)(*raw) * 0.00390625f;                                                /* convert raw data to real data */
@@ -643,6 +885,39 @@ uint8_t max30205_continuous_read(max30205_handle_t *handle, int16_t *raw, float
     return 0;                                                                            /* success return 0 */
 }
 
+/**
+ * @brief      read data continuously with a timestamp
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *s pointer to a converted temperature buffer
+ * @param[out] *timestamp_us pointer to a timestamp buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 continuous read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the timestamp is taken when the read completes and is 0 without a linked timestamp_us
+ */
+uint8_t max30205_continuous_read_timestamp(max30205_handle_t *handle, int16_t *raw, float *s, uint64_t *timestamp_us)
+{
+    uint8_t res;
+    
+    if ((handle == NULL) || (timestamp_us == NULL))                  /* check handle */
+    {
+        return 2;                                                    /* return error */
+    }
+    
+    res = max30205_continuous_read(handle, raw, s);                  /* read data */
+    if (res != 0)                                                    /* check result */
+    {
+        return res;                                                  /* return error */
+    }
+    *timestamp_us = MAX30205_TIMESTAMP_US(handle);                   /* sample time */
+    
+    return 0;                                                        /* success return 0 */
+}
+
+#if (MAX30205_CONFIG_SINGLE_READ == 1)
 /**
  * @brief      read data once
  * @param[in]  *handle pointer to a max30205 handle structure
@@ -671,26 +946,28 @@ uint8_t max30205_single_read(max30205_handle_t *handle, int16_t *raw, float *s)
     
     reg = handle->reg | (1 << 0);                                                          /* enter shutdown mode */
     reg = reg | (1 << 7);                                                                  /* set single read bit */
-    if (handle->iic_write(handle->iic_addr, MAX30205_REG_CONF, (uint8_t *)&reg, 1) != 0)   /* write conf */
+    if (MAX30205_IIC_WRITE(handle, MAX30205_REG_CONF, (uint8_t *)&reg, 1) != 0)            /* write conf */
     {
-        handle->debug_print("max30205: write failed.\n");                                  /* write failed */
+        MAX30205_DEBUG_PRINT(handle, "max30205: write failed.\n");                         /* write failed */
        
         return 1;                                                                          /* return error */
     }
-    handle->delay_ms(50);                                                                  /* delay 50 ms */
+    MAX30205_DELAY_MS(handle, 50);                                                         /* delay 50 ms */
     memset(buf, 0, sizeof(uint8_t) * 2);                                                   /* clear the buffer */
-    if (handle->iic_read(handle->iic_addr, MAX30205_REG_TEMP, (uint8_t *)buf, 2) != 0)     /* read two bytes */
+    if (MAX30205_IIC_READ(handle, MAX30205_REG_TEMP, (uint8_t *)buf, 2) != 0)              /* read two bytes */
     {
-        handle->debug_print("max30205: read failed.\n");                                   /* read failed */
+        MAX30205_DEBUG_PRINT(handle, "max30205: read failed.\n");                          /* read failed */
        
         return 1;                                                                          /* return error */
     }
+#if (MAX30205_CONFIG_EXTENDED_FORMAT == 1)
     if ((handle->reg & (1 << 5)) != 0)                                                     /* extended format */
     {
         *raw = (int16_t)(((uint16_t)buf[0]) << 8 | buf[1]);                                /* get raw data */
         *s = (float)(*raw) * 0.00390625f + 64.0f;                                          /* convert raw data to real data */
     }
     else                                                                                   /* normal format */
+#endif
     {
         *raw = (int16_t)(((uint16_t)buf[0]) << 8 | buf[1]);                                /* get raw data */
         *s = (float)(*raw) * 0.00390625f;                                                  /* convert raw data to real data */
@@ -699,6 +976,40 @@ uint8_t max30205_single_read(max30205_handle_t *handle, int16_t *raw, float *s)
     return 0;                                                                              /* success return 0 */
 }
 
+/**
+ * @brief      read data once with a timestamp
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *s pointer to a converted temperature buffer
+ * @param[out] *timestamp_us pointer to a timestamp buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the timestamp is taken when the read completes and is 0 without a linked timestamp_us
+ */
+uint8_t max30205_single_read_timestamp(max30205_handle_t *handle, int16_t *raw, float *s, uint64_t *timestamp_us)
+{
+    uint8_t res;
+    
+    if ((handle == NULL) || (timestamp_us == NULL))                  /* check handle */
+    {
+        return 2;                                                    /* return error */
+    }
+    
+    res = max30205_single_read(handle, raw, s);                      /* read data */
+    if (res != 0)                                                    /* check result */
+    {
+        return res;                                                  /* return error */
+    }
+    *timestamp_us = MAX30205_TIMESTAMP_US(handle);                   /* sample time */
+    
+    return 0;                                                        /* success return 0 */
+}
+#endif
+
+#if (MAX30205_CONFIG_THRESHOLD == 1)
 /**
  * @brief     set the chip interrupt low threshold
  * @param[in] *handle pointer to a max30205 handle structure
@@ -725,9 +1036,9 @@ uint8_t max30205_set_interrupt_low_threshold(max30205_handle_t *handle, int16_t
     
     buf[0] = (threshold >> 8) & 0xFF;                                                         /* MSB */
     buf[1] = threshold & 0xFF;                                                                /* LSB */
-    if (handle->iic_write(handle->iic_addr, MAX30205_REG_THYST, (uint8_t *)buf, 2) != 0)      /* write to register */
+    if (MAX30205_IIC_WRITE(handle, MAX30205_REG_THYST, (uint8_t *)buf, 2) != 0)               /* write to register */
     {
-        handle->debug_print("max30205: set interrupt low threshold failed.\n");               /* set interrupt low threshold failed */
+        MAX30205_DEBUG_PRINT(handle, "max30205: set interrupt low threshold failed.\n");      /* set interrupt low threshold failed */
         
         return 1;                                                                             /* return error */
     }
@@ -762,9 +1073,9 @@ uint8_t max30205_get_interrupt_low_threshold(max30205_handle_t *handle, int16_t
     }
     
     memset(buf, 0, sizeof(uint8_t) * 2);                                                  /* clear the buffer */
-    if (handle->iic_read(handle->iic_addr, MAX30205_REG_THYST, (uint8_t *)buf, 2) != 0)   /* read 2 bytes */
+    if (MAX30205_IIC_READ(handle, MAX30205_REG_THYST, (uint8_t *)buf, 2) != 0)            /* read 2 bytes */
     {
-        handle->debug_print("max30205: read failed.\n");                                  /* read thyst failed */
+        MAX30205_DEBUG_PRINT(handle, "max30205: read failed.\n");                         /* read thyst failed */
         
         return 1;                                                                         /* return error */
     }
@@ -799,9 +1110,9 @@ uint8_t max30205_set_interrupt_high_threshold(max30205_handle_t *handle, int16_t
     
     buf[0] = (threshold >> 8) & 0xFF;                                                       /* MSB */
     buf[1] = threshold & 0xFF;                                                              /* LSB */
-    if (handle->iic_write(handle->iic_addr, MAX30205_REG_TOS, (uint8_t *)buf, 2) != 0)      /* write to register */
+    if (MAX30205_IIC_WRITE(handle, MAX30205_REG_TOS, (uint8_t *)buf, 2) != 0)               /* write to register */
     {
-        handle->debug_print("max30205: set interrupt high threshold failed.\n");            /* set interrupt high threshold failed */
+        MAX30205_DEBUG_PRINT(handle, "max30205: set interrupt high threshold failed.\n");   /* set interrupt high threshold failed */
         
         return 1;                                                                           /* return error */
     }
@@ -836,9 +1147,9 @@ uint8_t max30205_get_interrupt_high_threshold(max30205_handle_t *handle, int16_t
     }
     
     memset(buf, 0, sizeof(uint8_t) * 2);                                                /* clear the buffer */
-    if (handle->iic_read(handle->iic_addr, MAX30205_REG_TOS, (uint8_t *)buf, 2) != 0)   /* read 2 bytes */
+    if (MAX30205_IIC_READ(handle, MAX30205_REG_TOS, (uint8_t *)buf, 2) != 0)            /* read 2 bytes */
     {
-        handle->debug_print("max30205: read failed.\n");                                /* read tos failed */
+        MAX30205_DEBUG_PRINT(handle, "max30205: read failed.\n");                       /* read tos failed */
         
         return 1;                                                                       /* return error */
     }
@@ -846,6 +1157,7 @@ uint8_t max30205_get_interrupt_high_threshold(max30205_handle_t *handle, int16_t
     
     return 0;                                                                           /* success return 0 */
 }
+#endif
 
 /**
  * @brief      convert a temperature value to a register raw data
@@ -869,11 +1181,13 @@ uint8_t max30205_convert_to_register(max30205_handle_t *handle, float s, int16_t
         return 3;                                         /* return error */
     }
     
+#if (MAX30205_CONFIG_EXTENDED_FORMAT == 1)
     if ((handle->reg & (1 << 5)) != 0)                    /* extended format */
     {
         *reg = (int16_t)((s - 64.0f) / 0.00390625f);      /* convert real data to register data */
     }
     else                                                  /* normal format */
+#endif
     {
         *reg = (int16_t)(s / 0.00390625f);                /* convert real data to register data */
     }
@@ -904,11 +1218,13 @@ uint8_t max30205_convert_to_data(max30205_handle_t *handle, int16_t reg, float *
         return 3;                                       /* return error */
     }
     
+#if (MAX30205_CONFIG_EXTENDED_FORMAT == 1)
     if ((handle->reg & (1 << 5)) != 0)                  /* extended format */
     {
         *s = (float)(reg) * 0.00390625f + 64.0f;        /* convert raw data to real data */
     }
     else                                                /* normal format */
+#endif
     {
         *s = (float)(reg) * 0.00390625f;                /* convert raw data to real data */
     }
@@ -940,9 +1256,9 @@ uint8_t max30205_power_down(max30205_handle_t *handle)
     }
     
     reg = handle->reg | 0x01;                                                                 /* set shutdown bit */
-    if (handle->iic_write(handle->iic_addr, MAX30205_REG_CONF, (uint8_t *)&reg, 1) != 0)      /* write to conf register */
+    if (MAX30205_IIC_WRITE(handle, MAX30205_REG_CONF, (uint8_t *)&reg, 1) != 0)               /* write to conf register */
     {
-        handle->debug_print("max30205: power down failed.\n");                                /* power down failed */
+        MAX30205_DEBUG_PRINT(handle, "max30205: power down failed.\n");                       /* power down failed */
         
         return 1;                                                                             /* return error */
     }
@@ -976,9 +1292,9 @@ uint8_t max30205_set_reg(max30205_handle_t *handle, uint8_t reg, uint8_t *buf, u
         return 3;                                                     /* return error */
     }
     
-    if (handle->iic_write(handle->iic_addr, reg, buf, len) != 0)      /* write data */
+    if (MAX30205_IIC_WRITE(handle, reg, buf, len) != 0)               /* write data */
     {
-        handle->debug_print("max30205: write failed.\n");             /* write failed */
+        MAX30205_DEBUG_PRINT(handle, "max30205: write failed.\n");    /* write failed */
         
         return 1;                                                     /* return error */
     }
@@ -1012,9 +1328,9 @@ uint8_t max30205_get_reg(max30205_handle_t *handle, uint8_t reg, uint8_t *buf, u
         return 3;                                                    /* return error */
     }
     
-   if (handle->iic_read(handle->iic_addr, reg, buf, len) != 0)       /* read data */
+   if (MAX30205_IIC_READ(handle, reg, buf, len) != 0)                /* read data */
     {
-        handle->debug_print("max30205: read failed.\n");             /* read failed */
+        MAX30205_DEBUG_PRINT(handle, "max30205: read failed.\n");    /* read failed */
         
         return 1;                                                    /* return error */
     }
@@ -1024,6 +1340,7 @@ uint8_t max30205_get_reg(max30205_handle_t *handle, uint8_t reg, uint8_t *buf, u
     }
 }
 
+#if (MAX30205_CONFIG_INFO == 1)
 /**
  * @brief      get chip's information
  * @param[out] *info pointer to a max30205 info structure
@@ -1052,3 +1369,4 @@ uint8_t max30205_info(max30205_info_t *info)
     
     return 0;                                                       /* success return 0 */
 }
+#endif
@@ -41,6 +41,7 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <string.h>
+#include "driver_max30205_config.h"
 
 #ifdef __cplusplus
 extern "C"{
@@ -161,9 +162,69 @@ typedef enum
  * @{
  */
 
+/**
+ * @brief max30205 bus operation structure definition
+ */
+typedef struct max30205_ops_s
+{
+    uint8_t (*iic_init)(void *ctx);                                                              /**< point to an iic_init function address */
+    uint8_t (*iic_deinit)(void *ctx);                                                            /**< point to an iic_deinit function address */
+    uint8_t (*iic_read)(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);       /**< point to an iic_read function address */
+    uint8_t (*iic_write)(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);      /**< point to an iic_write function address */
+    void (*delay_ms)(void *ctx, uint32_t ms);                                                    /**< point to a delay_ms function address */
+    void (*debug_print)(const char *const fmt, ...);                                             /**< point to a debug_print function address */
+    uint64_t (*timestamp_us)(void *ctx);                                                         /**< point to a timestamp_us function address, optional */
+} max30205_ops_t;
+
+/**
+ * @brief max30205 bus structure definition
+ */
+typedef struct max30205_bus_s
+{
+    const max30205_ops_t *ops;        /**< shared operation table */
+    void *ctx;                        /**< bus context passed to every operation */
+} max30205_bus_t;
+
+#if (MAX30205_CONFIG_SHARED_OPS == 1)
+/**
+ * @brief max30205 classic link structure definition
+ */
+typedef struct max30205_link_s
+{
+    uint8_t (*iic_init)(void);                                                          /**< point to an iic_init function address */
+    uint8_t (*iic_deinit)(void);                                                        /**< point to an iic_deinit function address */
+    uint8_t (*iic_read)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);         /**< point to an iic_read function address */
+    uint8_t (*iic_write)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);        /**< point to an iic_write function address */
+    void (*delay_ms)(uint32_t ms);                                                      /**< point to a delay_ms function address */
+    void (*debug_print)(const char *const fmt, ...);                                    /**< point to a debug_print function address */
+    uint64_t (*timestamp_us)(void);                                                     /**< point to a timestamp_us function address, optional */
+} max30205_link_t;
+
+/**
+ * @brief functions linked with the classic link macros
+ * @note  max30205_init copies them for the first classic handle and rejects a later classic
+ *        handle linked with other functions while one is still inited
+ */
+extern max30205_link_t g_max30205_link;
+
+/**
+ * @brief bus running the classic link functions
+ */
+extern const max30205_bus_t g_max30205_link_bus;
+#endif
+
 /**
  * @brief max30205 handle structure definition
  */
+#if (MAX30205_CONFIG_SHARED_OPS == 1)
+typedef struct max30205_handle_s
+{
+    const max30205_bus_t *bus;        /**< shared bus */
+    uint8_t iic_addr;                 /**< iic device address */
+    uint8_t inited;                   /**< inited flag */
+    uint8_t reg;                      /**< register */
+} max30205_handle_t;
+#else
 typedef struct max30205_handle_s
 {
     uint8_t iic_addr;                                                                   /**< iic device address */
@@ -173,9 +234,11 @@ typedef struct max30205_handle_s
     uint8_t (*iic_write)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);        /**< point to an iic_write function address */
     void (*delay_ms)(uint32_t ms);                                                      /**< point to a delay_ms function address */
     void (*debug_print)(const char *const fmt, ...);                                    /**< point to a debug_print function address */
+    uint64_t (*timestamp_us)(void);                                                     /**< point to a timestamp_us function address, optional */
     uint8_t inited;                                                                     /**< inited flag */
     uint8_t reg;                                                                        /**< register */
 } max30205_handle_t;
+#endif
 
 /**
  * @brief max30205 information structure definition
@@ -212,6 +275,94 @@ typedef struct max30205_info_s
  */
 #define DRIVER_MAX30205_LINK_INIT(HANDLE, STRUCTURE)   memset(HANDLE, 0, sizeof(STRUCTURE))
 
+#if (MAX30205_CONFIG_SHARED_OPS == 1)
+
+/**
+ * @brief     link the shared bus
+ * @param[in] HANDLE pointer to a max30205 handle structure
+ * @param[in] BUS pointer to a max30205 bus structure
+ * @note      every handle on one bus points at the same bus structure
+ */
+#define DRIVER_MAX30205_LINK_BUS(HANDLE, BUS)         (HANDLE)->bus = BUS
+
+/**
+ * @brief     get the operation table of a handle
+ * @param[in] HANDLE pointer to a max30205 handle structure
+ * @note      none
+ */
+#define MAX30205_OPS(HANDLE)                          ((HANDLE)->bus->ops)
+
+/**
+ * @brief     run an operation of a handle
+ * @param[in] HANDLE pointer to a max30205 handle structure
+ * @note      the driver and its modules call the bus only through these macros
+ */
+#define MAX30205_IIC_INIT(HANDLE)                     (HANDLE)->bus->ops->iic_init((HANDLE)->bus->ctx)
+#define MAX30205_IIC_DEINIT(HANDLE)                   (HANDLE)->bus->ops->iic_deinit((HANDLE)->bus->ctx)
+#define MAX30205_IIC_READ(HANDLE, REG, BUF, LEN)      (HANDLE)->bus->ops->iic_read((HANDLE)->bus->ctx, (HANDLE)->iic_addr, REG, BUF, LEN)
+#define MAX30205_IIC_WRITE(HANDLE, REG, BUF, LEN)     (HANDLE)->bus->ops->iic_write((HANDLE)->bus->ctx, (HANDLE)->iic_addr, REG, BUF, LEN)
+#define MAX30205_DELAY_MS(HANDLE, MS)                 (HANDLE)->bus->ops->delay_ms((HANDLE)->bus->ctx, MS)
+#define MAX30205_TIMESTAMP_US(HANDLE)                 (((HANDLE)->bus->ops->timestamp_us != NULL) ? \
+                                                       (HANDLE)->bus->ops->timestamp_us((HANDLE)->bus->ctx) : 0)
+
+/**
+ * @brief     link iic_init function
+ * @param[in] HANDLE pointer to a max30205 handle structure
+ * @param[in] FUC pointer to an iic_init function address
+ * @note      the classic functions are shared by every handle linked this way and must match
+ */
+#define DRIVER_MAX30205_LINK_IIC_INIT(HANDLE, FUC)    ((HANDLE)->bus = &g_max30205_link_bus, g_max30205_link.iic_init = FUC)
+
+/**
+ * @brief     link iic_deinit function
+ * @param[in] HANDLE pointer to a max30205 handle structure
+ * @param[in] FUC pointer to an iic_deinit function address
+ * @note      the classic functions are shared by every handle linked this way and must match
+ */
+#define DRIVER_MAX30205_LINK_IIC_DEINIT(HANDLE, FUC)  ((HANDLE)->bus = &g_max30205_link_bus, g_max30205_link.iic_deinit = FUC)
+
+/**
+ * @brief     link iic_read function
+ * @param[in] HANDLE pointer to a max30205 handle structure
+ * @param[in] FUC pointer to an iic_read function address
+ * @note      the classic functions are shared by every handle linked this way and must match
+ */
+#define DRIVER_MAX30205_LINK_IIC_READ(HANDLE, FUC)    ((HANDLE)->bus = &g_max30205_link_bus, g_max30205_link.iic_read = FUC)
+
+/**
+ * @brief     link iic_write function
+ * @param[in] HANDLE pointer to a max30205 handle structure
+ * @param[in] FUC pointer to an iic_write function address
+ * @note      the classic functions are shared by every handle linked this way and must match
+ */
+#define DRIVER_MAX30205_LINK_IIC_WRITE(HANDLE, FUC)   ((HANDLE)->bus = &g_max30205_link_bus, g_max30205_link.iic_write = FUC)
+
+/**
+ * @brief     link delay_ms function
+ * @param[in] HANDLE pointer to a max30205 handle structure
+ * @param[in] FUC pointer to a delay_ms function address
+ * @note      the classic functions are shared by every handle linked this way and must match
+ */
+#define DRIVER_MAX30205_LINK_DELAY_MS(HANDLE, FUC)    ((HANDLE)->bus = &g_max30205_link_bus, g_max30205_link.delay_ms = FUC)
+
+/**
+ * @brief     link debug_print function
+ * @param[in] HANDLE pointer to a max30205 handle structure
+ * @param[in] FUC pointer to a debug_print function address
+ * @note      the classic functions are shared by every handle linked this way and must match
+ */
+#define DRIVER_MAX30205_LINK_DEBUG_PRINT(HANDLE, FUC) ((HANDLE)->bus = &g_max30205_link_bus, g_max30205_link.debug_print = FUC)
+
+/**
+ * @brief     link timestamp_us function
+ * @param[in] HANDLE pointer to a max30205 handle structure
+ * @param[in] FUC pointer to a timestamp_us function address
+ * @note      optional, it returns a monotonic microsecond counter
+ */
+#define DRIVER_MAX30205_LINK_TIMESTAMP_US(HANDLE, FUC) ((HANDLE)->bus = &g_max30205_link_bus, g_max30205_link.timestamp_us = FUC)
+
+#else
+
 /**
  * @brief     link iic_init function
  * @param[in] HANDLE pointer to a max30205 handle structure
@@ -260,6 +411,35 @@ typedef struct max30205_info_s
  */
 #define DRIVER_MAX30205_LINK_DEBUG_PRINT(HANDLE, FUC) (HANDLE)->debug_print = FUC
 
+/**
+ * @brief     link timestamp_us function
+ * @param[in] HANDLE pointer to a max30205 handle structure
+ * @param[in] FUC pointer to a timestamp_us function address
+ * @note      optional, it returns a monotonic microsecond counter
+ */
+#define DRIVER_MAX30205_LINK_TIMESTAMP_US(HANDLE, FUC) (HANDLE)->timestamp_us = FUC
+
+/**
+ * @brief     get the operation table of a handle
+ * @param[in] HANDLE pointer to a max30205 handle structure
+ * @note      none
+ */
+#define MAX30205_OPS(HANDLE)                          (HANDLE)
+
+/**
+ * @brief     run an operation of a handle
+ * @param[in] HANDLE pointer to a max30205 handle structure
+ * @note      the driver and its modules call the bus only through these macros
+ */
+#define MAX30205_IIC_INIT(HANDLE)                     (HANDLE)->iic_init()
+#define MAX30205_IIC_DEINIT(HANDLE)                   (HANDLE)->iic_deinit()
+#define MAX30205_IIC_READ(HANDLE, REG, BUF, LEN)      (HANDLE)->iic_read((HANDLE)->iic_addr, REG, BUF, LEN)
+#define MAX30205_IIC_WRITE(HANDLE, REG, BUF, LEN)     (HANDLE)->iic_write((HANDLE)->iic_addr, REG, BUF, LEN)
+#define MAX30205_DELAY_MS(HANDLE, MS)                 (HANDLE)->delay_ms(MS)
+#define MAX30205_TIMESTAMP_US(HANDLE)                 (((HANDLE)->timestamp_us != NULL) ? (HANDLE)->timestamp_us() : 0)
+
+#endif
+
 /**
  * @}
  */
@@ -271,6 +451,7 @@ typedef struct max30205_info_s
  * @{
  */
 
+#if (MAX30205_CONFIG_INFO == 1)
 /**
  * @brief      get chip's information
  * @param[out] *info pointer to a max30205 info structure
@@ -280,6 +461,7 @@ typedef struct max30205_info_s
  * @note       none
  */
 uint8_t max30205_info(max30205_info_t *info);
+#endif
 
 /**
  * @brief     set the iic address pin
@@ -366,6 +548,22 @@ uint8_t max30205_stop_continuous_read(max30205_handle_t *handle);
  */
 uint8_t max30205_continuous_read(max30205_handle_t *handle, int16_t *raw, float *s);
 
+/**
+ * @brief      read data continuously with a timestamp
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *s pointer to a converted temperature buffer
+ * @param[out] *timestamp_us pointer to a timestamp buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 continuous read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the timestamp is taken when the read completes and is 0 without a linked timestamp_us
+ */
+uint8_t max30205_continuous_read_timestamp(max30205_handle_t *handle, int16_t *raw, float *s, uint64_t *timestamp_us);
+
+#if (MAX30205_CONFIG_SINGLE_READ == 1)
 /**
  * @brief      read data once
  * @param[in]  *handle pointer to a max30205 handle structure
@@ -380,6 +578,22 @@ uint8_t max30205_continuous_read(max30205_handle_t *handle, int16_t *raw, float
  */
 uint8_t max30205_single_read(max30205_handle_t *handle, int16_t *raw, float *s);
 
+/**
+ * @brief      read data once with a timestamp
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *s pointer to a converted temperature buffer
+ * @param[out] *timestamp_us pointer to a timestamp buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the timestamp is taken when the read completes and is 0 without a linked timestamp_us
+ */
+uint8_t max30205_single_read_timestamp(max30205_handle_t *handle, int16_t *raw, float *s, uint64_t *timestamp_us);
+#endif
+
 /**
  * @brief     set the chip data format
  * @param[in] *handle pointer to a max30205 handle structure
@@ -388,6 +602,7 @@ uint8_t max30205_single_read(max30205_handle_t *handle, int16_t *raw, float *s);
  *            - 0 success
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
+ *            - 4 extended format is disabled
  * @note      none
  */
 uint8_t max30205_set_data_format(max30205_handle_t *handle, max30205_data_format_t format);
@@ -523,6 +738,7 @@ uint8_t max30205_set_pin_polarity(max30205_handle_t *handle, max30205_pin_polari
  */
 uint8_t max30205_get_pin_polarity(max30205_handle_t *handle, max30205_pin_polarity_t *polarity);
 
+#if (MAX30205_CONFIG_THRESHOLD == 1)
 /**
  * @brief     set the chip interrupt low threshold
  * @param[in] *handle pointer to a max30205 handle structure
@@ -574,6 +790,7 @@ uint8_t max30205_set_interrupt_high_threshold(max30205_handle_t *handle, int16_t
  * @note       none
  */
 uint8_t max30205_get_interrupt_high_threshold(max30205_handle_t *handle, int16_t *threshold);
+#endif
 
 /**
  * @brief      convert a temperature value to a register raw data
@@ -0,0 +1,189 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_alarm.c
+ * @brief     driver max30205 alarm source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_max30205_alarm.h"
+
+/**
+ * @brief fault queue depth definition
+ */
+static const uint8_t gs_depth[4] = {1, 2, 4, 6};        /**< consecutive faults of each fault queue */
+
+/**
+ * @brief      configure an alarm channel from a handle
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[in]  low interrupt low threshold
+ * @param[in]  high interrupt high threshold
+ * @param[out] *alarm pointer to a max30205 alarm structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       interrupt mode, fault queue and pin polarity are taken from the handle, low and high
+ *             are the raw values passed to max30205_set_interrupt_low_threshold and
+ *             max30205_set_interrupt_high_threshold in the same data format as the samples
+ */
+uint8_t max30205_alarm_config(max30205_handle_t *handle, int16_t low, int16_t high, max30205_alarm_t *alarm)
+{
+    uint8_t res;
+    max30205_interrupt_mode_t mode;
+    max30205_fault_queue_t fault_queue;
+    max30205_pin_polarity_t polarity;
+    
+    if ((handle == NULL) || (alarm == NULL))                     /* check handle */
+    {
+        return 2;                                                /* return error */
+    }
+    
+    res = max30205_get_interrupt_mode(handle, &mode);            /* get interrupt mode */
+    if (res != 0)                                                /* check the result */
+    {
+        return res;                                              /* return error */
+    }
+    res = max30205_get_fault_queue(handle, &fault_queue);        /* get fault queue */
+    if (res != 0)                                                /* check the result */
+    {
+        return res;                                              /* return error */
+    }
+    res = max30205_get_pin_polarity(handle, &polarity);          /* get pin polarity */
+    if (res != 0)                                                /* check the result */
+    {
+        return res;                                              /* return error */
+    }
+    alarm->low = low;                                            /* set low threshold */
+    alarm->high = high;                                          /* set high threshold */
+    alarm->depth = gs_depth[fault_queue & 0x03];                 /* set depth */
+    alarm->mode = (uint8_t)mode;                                 /* set mode */
+    alarm->polarity = (uint8_t)polarity;                         /* set polarity */
+    alarm->count = 0;                                            /* reset counter */
+    alarm->tripped = 0;                                          /* wait for tos */
+    alarm->os = 0;                                               /* release os */
+    
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief      evaluate a group of alarm channels
+ * @param[in]  *alarm pointer to a max30205 alarm array
+ * @param[in]  *raw pointer to a raw temperature array
+ * @param[in]  len array length
+ * @param[out] *event pointer to an event array
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       raw[i] is one conversion of channel i, event[i] is set to 1 when the os output of
+ *             channel i trips (comparator mode toggles, interrupt mode asserts) and event can be NULL
+ */
+uint8_t max30205_alarm_evaluate(max30205_alarm_t *alarm, const int16_t *raw, uint16_t len, uint8_t *event)
+{
+    uint16_t i;
+    uint8_t fault;
+    uint8_t fire;
+    max30205_alarm_t *p;
+    
+    if ((alarm == NULL) || (raw == NULL))                                            /* check handle */
+    {
+        return 2;                                                                    /* return error */
+    }
+    
+    for (i = 0; i < len; i++)                                                        /* evaluate all channels */
+    {
+        p = &alarm[i];                                                               /* get the channel */
+        fault = (uint8_t)((p->tripped & (uint8_t)(raw[i] < p->low)) |
+                          ((p->tripped ^ 1U) & (uint8_t)(raw[i] > p->high)));        /* above tos or below thyst */
+        p->count = (uint8_t)((p->count + 1U) * fault);                               /* count consecutive faults */
+        fire = (uint8_t)(p->count >= p->depth);                                      /* fault queue is full */
+        p->tripped = (uint8_t)(p->tripped ^ fire);                                   /* wait for the other threshold */
+        p->count = (uint8_t)(p->count * (fire ^ 1U));                                /* restart the fault queue */
+        p->os = (uint8_t)((p->mode & (p->os | fire)) |
+                          ((p->mode ^ 1U) & p->tripped));                            /* interrupt latches, comparator follows */
+        if (event != NULL)                                                           /* check the event */
+        {
+            event[i] = fire;                                                         /* save the event */
+        }
+    }
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     clear a group of alarm channels
+ * @param[in] *alarm pointer to a max30205 alarm array
+ * @param[in] len array length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      it acts as a register read on the chip, interrupt mode channels release the os output
+ *            and comparator mode channels are not changed
+ */
+uint8_t max30205_alarm_clear(max30205_alarm_t *alarm, uint16_t len)
+{
+    uint16_t i;
+    
+    if (alarm == NULL)                                                      /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+    
+    for (i = 0; i < len; i++)                                               /* clear all channels */
+    {
+        alarm[i].os = (uint8_t)(alarm[i].os & (alarm[i].mode ^ 1U));        /* release interrupt mode os */
+    }
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief      get the os output of an alarm channel
+ * @param[in]  *alarm pointer to a max30205 alarm structure
+ * @param[out] *os pointer to an os asserted buffer
+ * @param[out] *level pointer to an os pin level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       level is the pin level after the pin polarity is applied
+ */
+uint8_t max30205_alarm_get_os(max30205_alarm_t *alarm, uint8_t *os, uint8_t *level)
+{
+    if (alarm == NULL)                                             /* check handle */
+    {
+        return 2;                                                  /* return error */
+    }
+    
+    *os = alarm->os;                                               /* get os */
+    *level = (uint8_t)(alarm->os ^ (alarm->polarity ^ 1U));        /* active low inverts the pin */
+    
+    return 0;                                                      /* success return 0 */
+}
@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_alarm.h
+ * @brief     driver max30205 alarm header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MAX30205_ALARM_H
+#define DRIVER_MAX30205_ALARM_H
+
+#include "driver_max30205.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup max30205_alarm_driver
+ * @{
+ */
+
+/**
+ * @brief max30205 alarm structure definition
+ */
+typedef struct max30205_alarm_s
+{
+    int16_t low;            /**< thyst raw threshold */
+    int16_t high;           /**< tos raw threshold */
+    uint8_t depth;          /**< consecutive faults to trip */
+    uint8_t mode;           /**< interrupt mode */
+    uint8_t polarity;       /**< pin polarity */
+    uint8_t count;          /**< consecutive fault counter */
+    uint8_t tripped;        /**< 0 wait for tos, 1 wait for thyst */
+    uint8_t os;             /**< os asserted flag */
+} max30205_alarm_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup max30205_alarm_driver max30205 alarm driver function
+ * @brief    max30205 alarm driver modules
+ * @ingroup  max30205_driver
+ * @{
+ */
+
+/**
+ * @brief      configure an alarm channel from a handle
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[in]  low interrupt low threshold
+ * @param[in]  high interrupt high threshold
+ * @param[out] *alarm pointer to a max30205 alarm structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       interrupt mode, fault queue and pin polarity are taken from the handle, low and high
+ *             are the raw values passed to max30205_set_interrupt_low_threshold and
+ *             max30205_set_interrupt_high_threshold in the same data format as the samples
+ */
+uint8_t max30205_alarm_config(max30205_handle_t *handle, int16_t low, int16_t high, max30205_alarm_t *alarm);
+
+/**
+ * @brief      evaluate a group of alarm channels
+ * @param[in]  *alarm pointer to a max30205 alarm array
+ * @param[in]  *raw pointer to a raw temperature array
+ * @param[in]  len array length
+ * @param[out] *event pointer to an event array
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       raw[i] is one conversion of channel i, event[i] is set to 1 when the os output of
+ *             channel i trips (comparator mode toggles, interrupt mode asserts) and event can be NULL
+ */
+uint8_t max30205_alarm_evaluate(max30205_alarm_t *alarm, const int16_t *raw, uint16_t len, uint8_t *event);
+
+/**
+ * @brief     clear a group of alarm channels
+ * @param[in] *alarm pointer to a max30205 alarm array
+ * @param[in] len array length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      it acts as a register read on the chip, interrupt mode channels release the os output
+ *            and comparator mode channels are not changed
+ */
+uint8_t max30205_alarm_clear(max30205_alarm_t *alarm, uint16_t len);
+
+/**
+ * @brief      get the os output of an alarm channel
+ * @param[in]  *alarm pointer to a max30205 alarm structure
+ * @param[out] *os pointer to an os asserted buffer
+ * @param[out] *level pointer to an os pin level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       level is the pin level after the pin polarity is applied
+ */
+uint8_t max30205_alarm_get_os(max30205_alarm_t *alarm, uint8_t *os, uint8_t *level);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,407 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_arbiter.c
+ * @brief     driver max30205 arbiter source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_max30205_arbiter.h"
+
+/**
+ * @brief arbiter read args structure definition
+ */
+typedef struct max30205_arbiter_read_args_s
+{
+    int16_t *raw;        /**< raw temperature buffer */
+    float *s;            /**< converted temperature buffer */
+} max30205_arbiter_read_args_t;
+
+/**
+ * @brief     continuous read transaction
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] *args pointer to a read args structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 continuous read failed
+ * @note      none
+ */
+static uint8_t a_max30205_arbiter_continuous_read(max30205_handle_t *handle, void *args)
+{
+    max30205_arbiter_read_args_t *p = (max30205_arbiter_read_args_t *)args;        /* get the args */
+    
+    return max30205_continuous_read(handle, p->raw, p->s);                         /* read data */
+}
+
+#if (MAX30205_CONFIG_SINGLE_READ == 1)
+/**
+ * @brief     single read transaction
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] *args pointer to a read args structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 single read failed
+ * @note      none
+ */
+static uint8_t a_max30205_arbiter_single_read(max30205_handle_t *handle, void *args)
+{
+    max30205_arbiter_read_args_t *p = (max30205_arbiter_read_args_t *)args;        /* get the args */
+    
+    return max30205_single_read(handle, p->raw, p->s);                             /* read data */
+}
+#endif
+
+/**
+ * @brief     take the next request from the queues
+ * @param[in] *arbiter pointer to a max30205 arbiter structure
+ * @return    pointer to the request or NULL when the queues are empty
+ * @note      an alarm head always runs first, then the oldest aged head, then the highest priority head
+ */
+static max30205_arbiter_request_t *a_max30205_arbiter_pop(max30205_arbiter_t *arbiter)
+{
+    max30205_arbiter_request_t *p;
+    uint8_t pick;
+    uint8_t i;
+    
+    pick = MAX30205_ARBITER_PRIORITY_MAX;                                                 /* no pick */
+    if (arbiter->head[MAX30205_ARBITER_PRIORITY_ALARM] == NULL)                           /* no alarm is queued */
+    {
+        for (i = MAX30205_ARBITER_PRIORITY_CONTROL; i < MAX30205_ARBITER_PRIORITY_MAX; i++)    /* every priority below alarm */
+        {
+            p = arbiter->head[i];                                                         /* get the head */
+            if ((p != NULL) && ((arbiter->transactions - p->ticket) >= arbiter->aging))   /* check the age */
+            {
+                if ((pick == MAX30205_ARBITER_PRIORITY_MAX) ||
+                    ((int32_t)(p->ticket - arbiter->head[pick]->ticket) < 0))             /* keep the oldest */
+                {
+                    pick = i;                                                             /* pick it */
+                }
+            }
+        }
+        if (pick != MAX30205_ARBITER_PRIORITY_MAX)                                        /* an aged request */
+        {
+            for (i = MAX30205_ARBITER_PRIORITY_CONTROL; i < pick; i++)                    /* every higher priority */
+            {
+                if (arbiter->head[i] != NULL)                                             /* it passes a queued request */
+                {
+                    arbiter->promoted++;                                                  /* count promoted */
+                    
+                    break;
+                }
+            }
+        }
+    }
+    if (pick == MAX30205_ARBITER_PRIORITY_MAX)                                            /* no aged request */
+    {
+        for (i = 0; i < MAX30205_ARBITER_PRIORITY_MAX; i++)                               /* highest priority first */
+        {
+            if (arbiter->head[i] != NULL)                                                 /* check the queue */
+            {
+                pick = i;                                                                 /* pick it */
+                
+                break;
+            }
+        }
+        if (pick == MAX30205_ARBITER_PRIORITY_MAX)                                        /* all queues are empty */
+        {
+            return NULL;                                                                  /* no request */
+        }
+    }
+    p = arbiter->head[pick];                                                              /* get the request */
+    arbiter->head[pick] = p->next;                                                        /* remove it */
+    if (arbiter->head[pick] == NULL)                                                      /* queue is empty */
+    {
+        arbiter->tail[pick] = NULL;                                                       /* clear queue tail */
+    }
+    
+    return p;                                                                             /* return the request */
+}
+
+/**
+ * @brief     initialize the arbiter
+ * @param[in] *arbiter pointer to a max30205 arbiter structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ * @note      use one arbiter for each iic bus and share it by all handles on that bus
+ */
+uint8_t max30205_arbiter_init(max30205_arbiter_t *arbiter)
+{
+    uint8_t i;
+    
+    if (arbiter == NULL)                                             /* check handle */
+    {
+        return 2;                                                    /* return error */
+    }
+    if ((arbiter->lock == NULL) || (arbiter->unlock == NULL) ||
+        (arbiter->wait == NULL) || (arbiter->notify == NULL))        /* check linked functions */
+    {
+        return 3;                                                    /* return error */
+    }
+    
+    for (i = 0; i < MAX30205_ARBITER_PRIORITY_MAX; i++)              /* every priority */
+    {
+        arbiter->head[i] = NULL;                                     /* clear queue head */
+        arbiter->tail[i] = NULL;                                     /* clear queue tail */
+    }
+    arbiter->busy = 0;                                               /* bus is idle */
+    arbiter->aging = MAX30205_ARBITER_AGING_DEFAULT;                 /* default aging */
+    arbiter->batches = 0;                                            /* clear batches */
+    arbiter->transactions = 0;                                       /* clear transactions */
+    arbiter->promoted = 0;                                           /* clear promoted */
+    arbiter->inited = 1;                                             /* flag finish initialization */
+    
+    return 0;                                                        /* success return 0 */
+}
+
+/**
+ * @brief     set the aging limit
+ * @param[in] *arbiter pointer to a max30205 arbiter structure
+ * @param[in] aging transactions a queued request can be passed by
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock or unlock failed
+ *            - 2 handle is NULL
+ *            - 3 arbiter is not initialized
+ *            - 4 aging is invalid
+ * @note      when no alarm is queued, a request that has waited aging transactions runs next,
+ *            so periodic and background traffic is never starved by control traffic
+ */
+uint8_t max30205_arbiter_set_aging(max30205_arbiter_t *arbiter, uint32_t aging)
+{
+    if (arbiter == NULL)                           /* check handle */
+    {
+        return 2;                                  /* return error */
+    }
+    if (arbiter->inited != 1)                      /* check arbiter initialization */
+    {
+        return 3;                                  /* return error */
+    }
+    if (aging == 0)                                /* check aging */
+    {
+        return 4;                                  /* return error */
+    }
+    
+    if (arbiter->lock(arbiter->mutex) != 0)        /* lock the bus */
+    {
+        return 1;                                  /* return error */
+    }
+    arbiter->aging = aging;                        /* set aging */
+    if (arbiter->unlock(arbiter->mutex) != 0)      /* unlock the bus */
+    {
+        return 1;                                  /* return error */
+    }
+    
+    return 0;                                      /* success return 0 */
+}
+
+/**
+ * @brief         submit a transaction and wait for it
+ * @param[in]     *arbiter pointer to a max30205 arbiter structure
+ * @param[in,out] *request pointer to a max30205 arbiter request structure
+ * @return        status code
+ *                - 0 success
+ *                - 1 transaction failed
+ *                - 2 handle is NULL
+ *                - 3 arbiter is not initialized
+ *                - 4 priority is invalid
+ * @note          request->handle, request->transaction, request->args and request->priority must be set,
+ *                the driver result is saved in request->res and a transaction that changes the handle
+ *                configuration and commits it runs atomically against all other transactions on the bus,
+ *                queued requests run highest priority first and in order within one priority, a failed
+ *                lock or unlock returns 1 and a lock that fails inside the combiner leaves the arbiter
+ *                busy, so it must be initialized again before the next submit
+ */
+uint8_t max30205_arbiter_submit(max30205_arbiter_t *arbiter, max30205_arbiter_request_t *request)
+{
+    max30205_arbiter_request_t *p;
+    
+    if ((arbiter == NULL) || (request == NULL))                             /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+    if ((request->handle == NULL) || (request->transaction == NULL))        /* check request */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (arbiter->inited != 1)                                               /* check arbiter initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+    if (request->priority >= MAX30205_ARBITER_PRIORITY_MAX)                 /* check priority */
+    {
+        return 4;                                                           /* return error */
+    }
+    
+    if (arbiter->lock(arbiter->mutex) != 0)                                 /* lock the bus */
+    {
+        return 1;                                                           /* return error */
+    }
+    request->done = 0;                                                      /* not done */
+    request->next = NULL;                                                   /* last request */
+    request->ticket = arbiter->transactions;                                /* save the queue time */
+    if (arbiter->tail[request->priority] != NULL)                           /* queue is not empty */
+    {
+        arbiter->tail[request->priority]->next = request;                   /* append */
+    }
+    else
+    {
+        arbiter->head[request->priority] = request;                         /* first request */
+    }
+    arbiter->tail[request->priority] = request;                             /* set tail */
+    while (request->done == 0)                                              /* wait for the request */
+    {
+        if (arbiter->busy == 0)                                             /* bus is idle, run the queues */
+        {
+            arbiter->busy = 1;                                              /* set busy */
+            while ((p = a_max30205_arbiter_pop(arbiter)) != NULL)           /* one request at a time so alarms are not held behind a batch */
+            {
+                if (arbiter->unlock(arbiter->mutex) != 0)                   /* new requests can be queued */
+                {
+                    p->res = 1;                                             /* the bus is still locked, fail it */
+                }
+                else
+                {
+                    p->res = p->transaction(p->handle, p->args);            /* run transaction */
+                    if (arbiter->lock(arbiter->mutex) != 0)                 /* lock the bus */
+                    {
+                        return 1;                                           /* the arbiter stays busy */
+                    }
+                }
+                arbiter->transactions++;                                    /* count transactions */
+                p->done = 1;                                                /* set done */
+                (void)arbiter->notify(arbiter->mutex);                      /* wake the waiters */
+            }
+            arbiter->batches++;                                             /* count batches */
+            arbiter->busy = 0;                                              /* bus is idle */
+        }
+        else
+        {
+            (void)arbiter->wait(arbiter->mutex);                            /* wait for the combiner */
+        }
+    }
+    if (arbiter->unlock(arbiter->mutex) != 0)                               /* unlock the bus */
+    {
+        return 1;                                                           /* return error */
+    }
+    
+    return (request->res != 0) ? 1 : 0;                                     /* return the result */
+}
+
+/**
+ * @brief      read data continuously through the arbiter
+ * @param[in]  *arbiter pointer to a max30205 arbiter structure
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *s pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 continuous read failed
+ *             - 2 handle is NULL
+ *             - 3 arbiter is not initialized
+ * @note       it runs at the periodic priority
+ */
+uint8_t max30205_arbiter_continuous_read(max30205_arbiter_t *arbiter, max30205_handle_t *handle, int16_t *raw, float *s)
+{
+    max30205_arbiter_read_args_t args;
+    max30205_arbiter_request_t request;
+    
+    args.raw = raw;                                                  /* set raw buffer */
+    args.s = s;                                                      /* set temperature buffer */
+    request.handle = handle;                                         /* set handle */
+    request.transaction = a_max30205_arbiter_continuous_read;        /* set transaction */
+    request.args = &args;                                            /* set args */
+    request.priority = MAX30205_ARBITER_PRIORITY_PERIODIC;           /* periodic priority */
+    request.res = 0;                                                 /* clear result */
+    
+    return max30205_arbiter_submit(arbiter, &request);               /* submit the request */
+}
+
+#if (MAX30205_CONFIG_SINGLE_READ == 1)
+/**
+ * @brief      read data once through the arbiter
+ * @param[in]  *arbiter pointer to a max30205 arbiter structure
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *s pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read failed
+ *             - 2 handle is NULL
+ *             - 3 arbiter is not initialized
+ * @note       the bus is held for the whole conversion and it runs at the periodic priority
+ */
+uint8_t max30205_arbiter_single_read(max30205_arbiter_t *arbiter, max30205_handle_t *handle, int16_t *raw, float *s)
+{
+    max30205_arbiter_read_args_t args;
+    max30205_arbiter_request_t request;
+    
+    args.raw = raw;                                              /* set raw buffer */
+    args.s = s;                                                  /* set temperature buffer */
+    request.handle = handle;                                     /* set handle */
+    request.transaction = a_max30205_arbiter_single_read;        /* set transaction */
+    request.args = &args;                                        /* set args */
+    request.priority = MAX30205_ARBITER_PRIORITY_PERIODIC;       /* periodic priority */
+    request.res = 0;                                             /* clear result */
+    
+    return max30205_arbiter_submit(arbiter, &request);           /* submit the request */
+}
+#endif
+
+/**
+ * @brief      read data after an alarm through the arbiter
+ * @param[in]  *arbiter pointer to a max30205 arbiter structure
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *s pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 continuous read failed
+ *             - 2 handle is NULL
+ *             - 3 arbiter is not initialized
+ * @note       it runs at the alarm priority and the read clears the os output in the interrupt mode
+ */
+uint8_t max30205_arbiter_alarm_read(max30205_arbiter_t *arbiter, max30205_handle_t *handle, int16_t *raw, float *s)
+{
+    max30205_arbiter_read_args_t args;
+    max30205_arbiter_request_t request;
+    
+    args.raw = raw;                                                  /* set raw buffer */
+    args.s = s;                                                      /* set temperature buffer */
+    request.handle = handle;                                         /* set handle */
+    request.transaction = a_max30205_arbiter_continuous_read;        /* set transaction */
+    request.args = &args;                                            /* set args */
+    request.priority = MAX30205_ARBITER_PRIORITY_ALARM;              /* alarm priority */
+    request.res = 0;                                                 /* clear result */
+    
+    return max30205_arbiter_submit(arbiter, &request);               /* submit the request */
+}
@@ -0,0 +1,275 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_arbiter.h
+ * @brief     driver max30205 arbiter header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MAX30205_ARBITER_H
+#define DRIVER_MAX30205_ARBITER_H
+
+#include "driver_max30205.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup max30205_arbiter_driver
+ * @{
+ */
+
+/**
+ * @brief max30205 arbiter priority enumeration definition
+ */
+typedef enum
+{
+    MAX30205_ARBITER_PRIORITY_ALARM      = 0x00,        /**< alarm clearing after an os edge */
+    MAX30205_ARBITER_PRIORITY_CONTROL    = 0x01,        /**< configuration and control */
+    MAX30205_ARBITER_PRIORITY_PERIODIC   = 0x02,        /**< periodic sampling */
+    MAX30205_ARBITER_PRIORITY_BACKGROUND = 0x03,        /**< background diagnostics */
+    MAX30205_ARBITER_PRIORITY_MAX        = 0x04,        /**< priority number */
+} max30205_arbiter_priority_t;
+
+/**
+ * @brief max30205 arbiter default aging definition
+ */
+#ifndef MAX30205_ARBITER_AGING_DEFAULT
+    #define MAX30205_ARBITER_AGING_DEFAULT 8        /**< transactions a request can be passed by */
+#endif
+
+/**
+ * @brief max30205 arbiter request structure definition
+ */
+typedef struct max30205_arbiter_request_s
+{
+    max30205_handle_t *handle;                                             /**< max30205 handle */
+    uint8_t (*transaction)(max30205_handle_t *handle, void *args);         /**< point to a transaction function address */
+    void *args;                                                            /**< transaction args */
+    max30205_arbiter_priority_t priority;                                  /**< transaction priority */
+    uint32_t ticket;                                                       /**< transactions executed when queued */
+    uint8_t res;                                                           /**< transaction result */
+    volatile uint8_t done;                                                 /**< done flag */
+    struct max30205_arbiter_request_s *next;                               /**< next request */
+} max30205_arbiter_request_t;
+
+/**
+ * @brief max30205 arbiter structure definition
+ */
+typedef struct max30205_arbiter_s
+{
+    uint8_t (*lock)(void *mutex);                                           /**< point to a lock function address */
+    uint8_t (*unlock)(void *mutex);                                         /**< point to an unlock function address */
+    uint8_t (*wait)(void *mutex);                                           /**< point to a wait function address */
+    uint8_t (*notify)(void *mutex);                                         /**< point to a notify function address */
+    void *mutex;                                                            /**< bus mutex */
+    max30205_arbiter_request_t *head[MAX30205_ARBITER_PRIORITY_MAX];        /**< queue head of each priority */
+    max30205_arbiter_request_t *tail[MAX30205_ARBITER_PRIORITY_MAX];        /**< queue tail of each priority */
+    uint8_t busy;                                                           /**< bus busy flag */
+    uint8_t inited;                                                         /**< inited flag */
+    uint32_t aging;                                                         /**< transactions a request can be passed by */
+    uint32_t batches;                                                       /**< combiner runs */
+    uint32_t transactions;                                                  /**< executed transactions */
+    uint32_t promoted;                                                      /**< requests run early by aging */
+} max30205_arbiter_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup max30205_arbiter_link_driver max30205 arbiter link driver function
+ * @brief    max30205 arbiter link driver modules
+ * @ingroup  max30205_arbiter_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize max30205_arbiter_t structure
+ * @param[in] ARBITER pointer to a max30205 arbiter structure
+ * @param[in] STRUCTURE max30205_arbiter_t
+ * @note      none
+ */
+#define DRIVER_MAX30205_ARBITER_LINK_INIT(ARBITER, STRUCTURE)   memset(ARBITER, 0, sizeof(STRUCTURE))
+
+/**
+ * @brief     link lock function
+ * @param[in] ARBITER pointer to a max30205 arbiter structure
+ * @param[in] FUC pointer to a lock function address
+ * @note      none
+ */
+#define DRIVER_MAX30205_ARBITER_LINK_LOCK(ARBITER, FUC)        (ARBITER)->lock = FUC
+
+/**
+ * @brief     link unlock function
+ * @param[in] ARBITER pointer to a max30205 arbiter structure
+ * @param[in] FUC pointer to an unlock function address
+ * @note      none
+ */
+#define DRIVER_MAX30205_ARBITER_LINK_UNLOCK(ARBITER, FUC)      (ARBITER)->unlock = FUC
+
+/**
+ * @brief     link wait function
+ * @param[in] ARBITER pointer to a max30205 arbiter structure
+ * @param[in] FUC pointer to a wait function address
+ * @note      wait must release the locked mutex, sleep until notify and lock the mutex again
+ */
+#define DRIVER_MAX30205_ARBITER_LINK_WAIT(ARBITER, FUC)        (ARBITER)->wait = FUC
+
+/**
+ * @brief     link notify function
+ * @param[in] ARBITER pointer to a max30205 arbiter structure
+ * @param[in] FUC pointer to a notify function address
+ * @note      notify must wake all waiters
+ */
+#define DRIVER_MAX30205_ARBITER_LINK_NOTIFY(ARBITER, FUC)      (ARBITER)->notify = FUC
+
+/**
+ * @brief     link the bus mutex
+ * @param[in] ARBITER pointer to a max30205 arbiter structure
+ * @param[in] MUTEX pointer to a bus mutex
+ * @note      none
+ */
+#define DRIVER_MAX30205_ARBITER_LINK_MUTEX(ARBITER, MUTEX)     (ARBITER)->mutex = MUTEX
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup max30205_arbiter_driver max30205 arbiter driver function
+ * @brief    max30205 arbiter driver modules
+ * @ingroup  max30205_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize the arbiter
+ * @param[in] *arbiter pointer to a max30205 arbiter structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ * @note      use one arbiter for each iic bus and share it by all handles on that bus
+ */
+uint8_t max30205_arbiter_init(max30205_arbiter_t *arbiter);
+
+/**
+ * @brief     set the aging limit
+ * @param[in] *arbiter pointer to a max30205 arbiter structure
+ * @param[in] aging transactions a queued request can be passed by
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock or unlock failed
+ *            - 2 handle is NULL
+ *            - 3 arbiter is not initialized
+ *            - 4 aging is invalid
+ * @note      when no alarm is queued, a request that has waited aging transactions runs next,
+ *            so periodic and background traffic is never starved by control traffic
+ */
+uint8_t max30205_arbiter_set_aging(max30205_arbiter_t *arbiter, uint32_t aging);
+
+/**
+ * @brief         submit a transaction and wait for it
+ * @param[in]     *arbiter pointer to a max30205 arbiter structure
+ * @param[in,out] *request pointer to a max30205 arbiter request structure
+ * @return        status code
+ *                - 0 success
+ *                - 1 transaction failed
+ *                - 2 handle is NULL
+ *                - 3 arbiter is not initialized
+ *                - 4 priority is invalid
+ * @note          request->handle, request->transaction, request->args and request->priority must be set,
+ *                the driver result is saved in request->res and a transaction that changes the handle
+ *                configuration and commits it runs atomically against all other transactions on the bus,
+ *                queued requests run highest priority first and in order within one priority, a failed
+ *                lock or unlock returns 1 and a lock that fails inside the combiner leaves the arbiter
+ *                busy, so it must be initialized again before the next submit
+ */
+uint8_t max30205_arbiter_submit(max30205_arbiter_t *arbiter, max30205_arbiter_request_t *request);
+
+/**
+ * @brief      read data continuously through the arbiter
+ * @param[in]  *arbiter pointer to a max30205 arbiter structure
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *s pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 continuous read failed
+ *             - 2 handle is NULL
+ *             - 3 arbiter is not initialized
+ * @note       it runs at the periodic priority
+ */
+uint8_t max30205_arbiter_continuous_read(max30205_arbiter_t *arbiter, max30205_handle_t *handle, int16_t *raw, float *s);
+
+#if (MAX30205_CONFIG_SINGLE_READ == 1)
+/**
+ * @brief      read data once through the arbiter
+ * @param[in]  *arbiter pointer to a max30205 arbiter structure
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *s pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read failed
+ *             - 2 handle is NULL
+ *             - 3 arbiter is not initialized
+ * @note       the bus is held for the whole conversion and it runs at the periodic priority
+ */
+uint8_t max30205_arbiter_single_read(max30205_arbiter_t *arbiter, max30205_handle_t *handle, int16_t *raw, float *s);
+#endif
+
+/**
+ * @brief      read data after an alarm through the arbiter
+ * @param[in]  *arbiter pointer to a max30205 arbiter structure
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *s pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 continuous read failed
+ *             - 2 handle is NULL
+ *             - 3 arbiter is not initialized
+ * @note       it runs at the alarm priority and the read clears the os output in the interrupt mode
+ */
+uint8_t max30205_arbiter_alarm_read(max30205_arbiter_t *arbiter, max30205_handle_t *handle, int16_t *raw, float *s);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,446 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_async.c
+ * @brief     driver max30205 async source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_max30205_async.h"
+
+/**
+ * @brief chip register definition
+ */
+#define MAX30205_REG_TEMP         0x00        /**< temperature register */
+#define MAX30205_REG_CONF         0x01        /**< configure register */
+#define MAX30205_REG_THYST        0x02        /**< thyst register */
+#define MAX30205_REG_TOS          0x03        /**< tos register */
+
+/**
+ * @brief     finish a request
+ * @param[in] *request pointer to a max30205 async request structure
+ * @param[in] res request result
+ * @note      none
+ */
+static void a_max30205_async_finish(max30205_async_request_t *request, uint8_t res)
+{
+    request->res = res;                    /* save the result */
+    request->busy = 0;                     /* request is free */
+    if (request->callback != NULL)         /* check the callback */
+    {
+        request->callback(request);        /* run the callback */
+    }
+}
+
+/**
+ * @brief     issue the next bus step of a request
+ * @param[in] *request pointer to a max30205 async request structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 issue failed
+ * @note      none
+ */
+static uint8_t a_max30205_async_issue(max30205_async_request_t *request)
+{
+    const max30205_async_t *async = request->async;                                                       /* get the bus */
+    max30205_handle_t *handle = request->handle;                                                          /* get the handle */
+    
+    switch (request->type)                                                                                /* check the type */
+    {
+        case MAX30205_ASYNC_TYPE_CONTINUOUS_READ :
+        {
+            return async->iic_read(handle->iic_addr, MAX30205_REG_TEMP, request->buf, 2, request);        /* read two bytes */
+        }
+        case MAX30205_ASYNC_TYPE_SINGLE_READ :
+        {
+            if (request->step == 0)                                                                       /* trigger */
+            {
+                request->buf[0] = handle->reg | (1 << 0) | (1 << 7);                                      /* shutdown and one-shot */
+                
+                return async->iic_write(handle->iic_addr, MAX30205_REG_CONF, request->buf, 1, request);   /* write conf */
+            }
+            else if (request->step == 1)                                                                  /* conversion */
+            {
+                return async->timer_start(50, request);                                                   /* wait 50 ms */
+            }
+            else                                                                                          /* result */
+            {
+                return async->iic_read(handle->iic_addr, MAX30205_REG_TEMP, request->buf, 2, request);    /* read two bytes */
+            }
+        }
+        case MAX30205_ASYNC_TYPE_START_CONTINUOUS_READ :
+        {
+            request->buf[0] = handle->reg & (~((1 << 0) | (1 << 7)));                                     /* exit shutdown mode */
+            
+            return async->iic_write(handle->iic_addr, MAX30205_REG_CONF, request->buf, 1, request);       /* write conf */
+        }
+        case MAX30205_ASYNC_TYPE_STOP_CONTINUOUS_READ :
+        {
+            request->buf[0] = handle->reg | (1 << 0) | (1 << 7);                                          /* enter shutdown mode */
+            
+            return async->iic_write(handle->iic_addr, MAX30205_REG_CONF, request->buf, 1, request);       /* write conf */
+        }
+        case MAX30205_ASYNC_TYPE_SET_LOW_THRESHOLD :
+        {
+            return async->iic_write(handle->iic_addr, MAX30205_REG_THYST, request->buf, 2, request);      /* write thyst */
+        }
+        case MAX30205_ASYNC_TYPE_GET_LOW_THRESHOLD :
+        {
+            return async->iic_read(handle->iic_addr, MAX30205_REG_THYST, request->buf, 2, request);       /* read thyst */
+        }
+        case MAX30205_ASYNC_TYPE_SET_HIGH_THRESHOLD :
+        {
+            return async->iic_write(handle->iic_addr, MAX30205_REG_TOS, request->buf, 2, request);        /* write tos */
+        }
+        case MAX30205_ASYNC_TYPE_GET_HIGH_THRESHOLD :
+        {
+            return async->iic_read(handle->iic_addr, MAX30205_REG_TOS, request->buf, 2, request);         /* read tos */
+        }
+        default :
+        {
+            return 1;                                                                                     /* return error */
+        }
+    }
+}
+
+/**
+ * @brief     submit a request
+ * @param[in] *async pointer to a max30205 async bus structure
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] *request pointer to a max30205 async request structure
+ * @param[in] type request type
+ * @param[in] *callback pointer to a completion callback
+ * @param[in] *user pointer to user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 request is busy
+ * @note      request->buf must be prepared by the caller for the write requests
+ */
+static uint8_t a_max30205_async_submit(const max30205_async_t *async, max30205_handle_t *handle,
+                                       max30205_async_request_t *request, max30205_async_type_t type,
+                                       void (*callback)(max30205_async_request_t *request), void *user)
+{
+    if ((async == NULL) || (handle == NULL) || (request == NULL))                                  /* check handle */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if ((async->iic_read == NULL) || (async->iic_write == NULL) || (async->timer_start == NULL))   /* check the bus hooks */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                                       /* check handle initialization */
+    {
+        return 3;                                                                                  /* return error */
+    }
+    if (request->busy != 0)                                                                        /* check the request */
+    {
+        return 4;                                                                                  /* return error */
+    }
+    
+    request->handle = handle;                                                                      /* set handle */
+    request->async = async;                                                                        /* set bus */
+    request->callback = callback;                                                                  /* set callback */
+    request->user = user;                                                                          /* set user data */
+    request->type = (uint8_t)type;                                                                 /* set type */
+    request->step = 0;                                                                             /* first step */
+    request->res = 0;                                                                              /* clear result */
+    request->busy = 1;                                                                             /* request is in flight */
+    if (a_max30205_async_issue(request) != 0)                                                      /* issue the first step */
+    {
+        request->busy = 0;                                                                         /* request is free */
+        
+        return 1;                                                                                  /* return error */
+    }
+    
+    return 0;                                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     complete the current step of a request
+ * @param[in] *request pointer to a max30205 async request structure
+ * @param[in] res bus result
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 request is not busy
+ * @note      the bus hooks return 0 after queueing the transfer and call this function from the
+ *            dma or irq completion with res 0 on success, a hook that returns non-zero must not call it
+ */
+uint8_t max30205_async_complete(max30205_async_request_t *request, uint8_t res)
+{
+    uint8_t last;
+    
+    if (request == NULL)                                                                 /* check handle */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (request->busy == 0)                                                              /* check the request */
+    {
+        return 4;                                                                        /* return error */
+    }
+    
+    if (res != 0)                                                                        /* bus failed */
+    {
+        a_max30205_async_finish(request, 1);                                             /* finish with error */
+        
+        return 0;                                                                        /* success return 0 */
+    }
+    last = (request->type != MAX30205_ASYNC_TYPE_SINGLE_READ) || (request->step == 2);   /* check the last step */
+    if (last == 0)                                                                       /* more steps */
+    {
+        request->step++;                                                                 /* next step */
+        if (a_max30205_async_issue(request) != 0)                                        /* issue the next step */
+        {
+            a_max30205_async_finish(request, 1);                                         /* finish with error */
+        }
+        
+        return 0;                                                                        /* success return 0 */
+    }
+    
+    if ((request->type == MAX30205_ASYNC_TYPE_CONTINUOUS_READ) ||
+        (request->type == MAX30205_ASYNC_TYPE_SINGLE_READ) ||
+        (request->type == MAX30205_ASYNC_TYPE_GET_LOW_THRESHOLD) ||
+        (request->type == MAX30205_ASYNC_TYPE_GET_HIGH_THRESHOLD))                       /* read requests */
+    {
+        request->raw = (int16_t)(((uint16_t)request->buf[0]) << 8 | request->buf[1]);    /* get raw data */
+#if (MAX30205_CONFIG_EXTENDED_FORMAT == 1)
+        if ((request->handle->reg & (1 << 5)) != 0)                                      /* extended format */
+        {
+            request->s = (float)(request->raw) * 0.00390625f + 64.0f;                    /* convert raw data to real data */
+        }
+        else                                                                             /* normal format */
+#endif
+        {
+            request->s = (float)(request->raw) * 0.00390625f;                            /* convert raw data to real data */
+        }
+    }
+    a_max30205_async_finish(request, 0);                                                 /* finish */
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief     submit a continuous read
+ * @param[in] *async pointer to a max30205 async bus structure
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] *request pointer to a max30205 async request structure
+ * @param[in] *callback pointer to a completion callback
+ * @param[in] *user pointer to user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 request is busy
+ * @note      request->raw and request->s are valid in the callback when request->res is 0
+ */
+uint8_t max30205_async_continuous_read(const max30205_async_t *async, max30205_handle_t *handle,
+                                       max30205_async_request_t *request,
+                                       void (*callback)(max30205_async_request_t *request), void *user)
+{
+    return a_max30205_async_submit(async, handle, request, MAX30205_ASYNC_TYPE_CONTINUOUS_READ, callback, user);   /* submit */
+}
+
+/**
+ * @brief     submit a single read
+ * @param[in] *async pointer to a max30205 async bus structure
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] *request pointer to a max30205 async request structure
+ * @param[in] *callback pointer to a completion callback
+ * @param[in] *user pointer to user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 request is busy
+ * @note      the 50 ms conversion runs on timer_start, request->raw and request->s are valid in
+ *            the callback when request->res is 0
+ */
+uint8_t max30205_async_single_read(const max30205_async_t *async, max30205_handle_t *handle,
+                                   max30205_async_request_t *request,
+                                   void (*callback)(max30205_async_request_t *request), void *user)
+{
+    return a_max30205_async_submit(async, handle, request, MAX30205_ASYNC_TYPE_SINGLE_READ, callback, user);   /* submit */
+}
+
+/**
+ * @brief     submit a start continuous read
+ * @param[in] *async pointer to a max30205 async bus structure
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] *request pointer to a max30205 async request structure
+ * @param[in] *callback pointer to a completion callback
+ * @param[in] *user pointer to user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 request is busy
+ * @note      it commits the handle configuration to the conf register
+ */
+uint8_t max30205_async_start_continuous_read(const max30205_async_t *async, max30205_handle_t *handle,
+                                             max30205_async_request_t *request,
+                                             void (*callback)(max30205_async_request_t *request), void *user)
+{
+    return a_max30205_async_submit(async, handle, request, MAX30205_ASYNC_TYPE_START_CONTINUOUS_READ, callback, user);   /* submit */
+}
+
+/**
+ * @brief     submit a stop continuous read
+ * @param[in] *async pointer to a max30205 async bus structure
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] *request pointer to a max30205 async request structure
+ * @param[in] *callback pointer to a completion callback
+ * @param[in] *user pointer to user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 request is busy
+ * @note      it commits the handle configuration to the conf register in shutdown mode
+ */
+uint8_t max30205_async_stop_continuous_read(const max30205_async_t *async, max30205_handle_t *handle,
+                                            max30205_async_request_t *request,
+                                            void (*callback)(max30205_async_request_t *request), void *user)
+{
+    return a_max30205_async_submit(async, handle, request, MAX30205_ASYNC_TYPE_STOP_CONTINUOUS_READ, callback, user);   /* submit */
+}
+
+/**
+ * @brief     submit a set interrupt low threshold
+ * @param[in] *async pointer to a max30205 async bus structure
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] threshold interrupt low threshold
+ * @param[in] *request pointer to a max30205 async request structure
+ * @param[in] *callback pointer to a completion callback
+ * @param[in] *user pointer to user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 request is busy
+ * @note      none
+ */
+uint8_t max30205_async_set_interrupt_low_threshold(const max30205_async_t *async, max30205_handle_t *handle, int16_t threshold,
+                                                   max30205_async_request_t *request,
+                                                   void (*callback)(max30205_async_request_t *request), void *user)
+{
+    if ((request == NULL) || (request->busy != 0))                                                                       /* check the request */
+    {
+        return a_max30205_async_submit(async, handle, request, MAX30205_ASYNC_TYPE_SET_LOW_THRESHOLD, callback, user);   /* report the error */
+    }
+    
+    request->buf[0] = (threshold >> 8) & 0xFF;                                                                           /* MSB */
+    request->buf[1] = threshold & 0xFF;                                                                                  /* LSB */
+    
+    return a_max30205_async_submit(async, handle, request, MAX30205_ASYNC_TYPE_SET_LOW_THRESHOLD, callback, user);       /* submit */
+}
+
+/**
+ * @brief     submit a get interrupt low threshold
+ * @param[in] *async pointer to a max30205 async bus structure
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] *request pointer to a max30205 async request structure
+ * @param[in] *callback pointer to a completion callback
+ * @param[in] *user pointer to user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 request is busy
+ * @note      request->raw is valid in the callback when request->res is 0
+ */
+uint8_t max30205_async_get_interrupt_low_threshold(const max30205_async_t *async, max30205_handle_t *handle,
+                                                   max30205_async_request_t *request,
+                                                   void (*callback)(max30205_async_request_t *request), void *user)
+{
+    return a_max30205_async_submit(async, handle, request, MAX30205_ASYNC_TYPE_GET_LOW_THRESHOLD, callback, user);   /* submit */
+}
+
+/**
+ * @brief     submit a set interrupt high threshold
+ * @param[in] *async pointer to a max30205 async bus structure
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] threshold interrupt high threshold
+ * @param[in] *request pointer to a max30205 async request structure
+ * @param[in] *callback pointer to a completion callback
+ * @param[in] *user pointer to user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 request is busy
+ * @note      none
+ */
+uint8_t max30205_async_set_interrupt_high_threshold(const max30205_async_t *async, max30205_handle_t *handle, int16_t threshold,
+                                                    max30205_async_request_t *request,
+                                                    void (*callback)(max30205_async_request_t *request), void *user)
+{
+    if ((request == NULL) || (request->busy != 0))                                                                        /* check the request */
+    {
+        return a_max30205_async_submit(async, handle, request, MAX30205_ASYNC_TYPE_SET_HIGH_THRESHOLD, callback, user);   /* report the error */
+    }
+    
+    request->buf[0] = (threshold >> 8) & 0xFF;                                                                            /* MSB */
+    request->buf[1] = threshold & 0xFF;                                                                                   /* LSB */
+    
+    return a_max30205_async_submit(async, handle, request, MAX30205_ASYNC_TYPE_SET_HIGH_THRESHOLD, callback, user);       /* submit */
+}
+
+/**
+ * @brief     submit a get interrupt high threshold
+ * @param[in] *async pointer to a max30205 async bus structure
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] *request pointer to a max30205 async request structure
+ * @param[in] *callback pointer to a completion callback
+ * @param[in] *user pointer to user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 request is busy
+ * @note      request->raw is valid in the callback when request->res is 0
+ */
+uint8_t max30205_async_get_interrupt_high_threshold(const max30205_async_t *async, max30205_handle_t *handle,
+                                                    max30205_async_request_t *request,
+                                                    void (*callback)(max30205_async_request_t *request), void *user)
+{
+    return a_max30205_async_submit(async, handle, request, MAX30205_ASYNC_TYPE_GET_HIGH_THRESHOLD, callback, user);   /* submit */
+}
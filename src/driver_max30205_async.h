@@ -0,0 +1,283 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_async.h
+ * @brief     driver max30205 async header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MAX30205_ASYNC_H
+#define DRIVER_MAX30205_ASYNC_H
+
+#include "driver_max30205.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup max30205_async_driver
+ * @{
+ */
+
+/**
+ * @brief max30205 async type enumeration definition
+ */
+typedef enum
+{
+    MAX30205_ASYNC_TYPE_CONTINUOUS_READ       = 0x00,        /**< continuous read */
+    MAX30205_ASYNC_TYPE_SINGLE_READ           = 0x01,        /**< single read */
+    MAX30205_ASYNC_TYPE_START_CONTINUOUS_READ = 0x02,        /**< start continuous read */
+    MAX30205_ASYNC_TYPE_STOP_CONTINUOUS_READ  = 0x03,        /**< stop continuous read */
+    MAX30205_ASYNC_TYPE_SET_LOW_THRESHOLD     = 0x04,        /**< set interrupt low threshold */
+    MAX30205_ASYNC_TYPE_GET_LOW_THRESHOLD     = 0x05,        /**< get interrupt low threshold */
+    MAX30205_ASYNC_TYPE_SET_HIGH_THRESHOLD    = 0x06,        /**< set interrupt high threshold */
+    MAX30205_ASYNC_TYPE_GET_HIGH_THRESHOLD    = 0x07,        /**< get interrupt high threshold */
+} max30205_async_type_t;
+
+/**
+ * @brief max30205 async request structure definition
+ */
+typedef struct max30205_async_request_s
+{
+    max30205_handle_t *handle;                                                /**< max30205 handle */
+    const struct max30205_async_s *async;                                     /**< async bus */
+    void (*callback)(struct max30205_async_request_s *request);               /**< point to a completion callback address */
+    void *user;                                                               /**< user data */
+    uint8_t type;                                                             /**< request type */
+    uint8_t step;                                                             /**< request step */
+    uint8_t res;                                                              /**< request result */
+    volatile uint8_t busy;                                                    /**< busy flag */
+    uint8_t buf[2];                                                           /**< transfer buffer */
+    int16_t raw;                                                              /**< raw temperature or threshold */
+    float s;                                                                  /**< converted temperature */
+} max30205_async_request_t;
+
+/**
+ * @brief max30205 async bus structure definition
+ */
+typedef struct max30205_async_s
+{
+    uint8_t (*iic_read)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                        max30205_async_request_t *request);                   /**< point to a non-blocking iic_read function address */
+    uint8_t (*iic_write)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                         max30205_async_request_t *request);                  /**< point to a non-blocking iic_write function address */
+    uint8_t (*timer_start)(uint32_t ms, max30205_async_request_t *request);   /**< point to a one-shot timer function address */
+} max30205_async_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup max30205_async_driver max30205 async driver function
+ * @brief    max30205 async driver modules
+ * @ingroup  max30205_driver
+ * @{
+ */
+
+/**
+ * @brief     complete the current step of a request
+ * @param[in] *request pointer to a max30205 async request structure
+ * @param[in] res bus result
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 request is not busy
+ * @note      the bus hooks return 0 after queueing the transfer and call this function from the
+ *            dma or irq completion with res 0 on success, a hook that returns non-zero must not call it
+ */
+uint8_t max30205_async_complete(max30205_async_request_t *request, uint8_t res);
+
+/**
+ * @brief     submit a continuous read
+ * @param[in] *async pointer to a max30205 async bus structure
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] *request pointer to a max30205 async request structure
+ * @param[in] *callback pointer to a completion callback
+ * @param[in] *user pointer to user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 request is busy
+ * @note      request->raw and request->s are valid in the callback when request->res is 0
+ */
+uint8_t max30205_async_continuous_read(const max30205_async_t *async, max30205_handle_t *handle,
+                                       max30205_async_request_t *request,
+                                       void (*callback)(max30205_async_request_t *request), void *user);
+
+/**
+ * @brief     submit a single read
+ * @param[in] *async pointer to a max30205 async bus structure
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] *request pointer to a max30205 async request structure
+ * @param[in] *callback pointer to a completion callback
+ * @param[in] *user pointer to user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 request is busy
+ * @note      the 50 ms conversion runs on timer_start, request->raw and request->s are valid in
+ *            the callback when request->res is 0
+ */
+uint8_t max30205_async_single_read(const max30205_async_t *async, max30205_handle_t *handle,
+                                   max30205_async_request_t *request,
+                                   void (*callback)(max30205_async_request_t *request), void *user);
+
+/**
+ * @brief     submit a start continuous read
+ * @param[in] *async pointer to a max30205 async bus structure
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] *request pointer to a max30205 async request structure
+ * @param[in] *callback pointer to a completion callback
+ * @param[in] *user pointer to user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 request is busy
+ * @note      it commits the handle configuration to the conf register
+ */
+uint8_t max30205_async_start_continuous_read(const max30205_async_t *async, max30205_handle_t *handle,
+                                             max30205_async_request_t *request,
+                                             void (*callback)(max30205_async_request_t *request), void *user);
+
+/**
+ * @brief     submit a stop continuous read
+ * @param[in] *async pointer to a max30205 async bus structure
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] *request pointer to a max30205 async request structure
+ * @param[in] *callback pointer to a completion callback
+ * @param[in] *user pointer to user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 request is busy
+ * @note      it commits the handle configuration to the conf register in shutdown mode
+ */
+uint8_t max30205_async_stop_continuous_read(const max30205_async_t *async, max30205_handle_t *handle,
+                                            max30205_async_request_t *request,
+                                            void (*callback)(max30205_async_request_t *request), void *user);
+
+/**
+ * @brief     submit a set interrupt low threshold
+ * @param[in] *async pointer to a max30205 async bus structure
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] threshold interrupt low threshold
+ * @param[in] *request pointer to a max30205 async request structure
+ * @param[in] *callback pointer to a completion callback
+ * @param[in] *user pointer to user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 request is busy
+ * @note      none
+ */
+uint8_t max30205_async_set_interrupt_low_threshold(const max30205_async_t *async, max30205_handle_t *handle, int16_t threshold,
+                                                   max30205_async_request_t *request,
+                                                   void (*callback)(max30205_async_request_t *request), void *user);
+
+/**
+ * @brief     submit a get interrupt low threshold
+ * @param[in] *async pointer to a max30205 async bus structure
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] *request pointer to a max30205 async request structure
+ * @param[in] *callback pointer to a completion callback
+ * @param[in] *user pointer to user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 request is busy
+ * @note      request->raw is valid in the callback when request->res is 0
+ */
+uint8_t max30205_async_get_interrupt_low_threshold(const max30205_async_t *async, max30205_handle_t *handle,
+                                                   max30205_async_request_t *request,
+                                                   void (*callback)(max30205_async_request_t *request), void *user);
+
+/**
+ * @brief     submit a set interrupt high threshold
+ * @param[in] *async pointer to a max30205 async bus structure
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] threshold interrupt high threshold
+ * @param[in] *request pointer to a max30205 async request structure
+ * @param[in] *callback pointer to a completion callback
+ * @param[in] *user pointer to user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 request is busy
+ * @note      none
+ */
+uint8_t max30205_async_set_interrupt_high_threshold(const max30205_async_t *async, max30205_handle_t *handle, int16_t threshold,
+                                                    max30205_async_request_t *request,
+                                                    void (*callback)(max30205_async_request_t *request), void *user);
+
+/**
+ * @brief     submit a get interrupt high threshold
+ * @param[in] *async pointer to a max30205 async bus structure
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] *request pointer to a max30205 async request structure
+ * @param[in] *callback pointer to a completion callback
+ * @param[in] *user pointer to user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 request is busy
+ * @note      request->raw is valid in the callback when request->res is 0
+ */
+uint8_t max30205_async_get_interrupt_high_threshold(const max30205_async_t *async, max30205_handle_t *handle,
+                                                    max30205_async_request_t *request,
+                                                    void (*callback)(max30205_async_request_t *request), void *user);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,201 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_attach.c
+ * @brief     driver max30205 attach source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_max30205_attach.h"
+
+/**
+ * @brief chip register definition
+ */
+#define MAX30205_REG_CONF          0x01        /**< configuration register */
+#define MAX30205_REG_THYST         0x02        /**< hysteresis register */
+#define MAX30205_REG_TOS           0x03        /**< overtemperature register */
+
+/**
+ * @brief      read a threshold register
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[in]  reg register address
+ * @param[out] *value pointer to a register value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_max30205_attach_read(max30205_handle_t *handle, uint8_t reg, int16_t *value)
+{
+    uint8_t buf[2];
+    
+    memset(buf, 0, sizeof(uint8_t) * 2);                               /* clear the buffer */
+    if (MAX30205_IIC_READ(handle, reg, (uint8_t *)buf, 2) != 0)        /* read two bytes */
+    {
+        return 1;                                                      /* return error */
+    }
+    *value = (int16_t)(((uint16_t)buf[0]) << 8 | buf[1]);              /* get value */
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief     write a threshold register and read it back
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] reg register address
+ * @param[in] value register value
+ * @return    status code
+ *            - 0 success
+ *            - 1 read or write failed
+ *            - 4 value did not read back
+ * @note      none
+ */
+static uint8_t a_max30205_attach_write(max30205_handle_t *handle, uint8_t reg, int16_t value)
+{
+    uint8_t buf[2];
+    int16_t check;
+    
+    buf[0] = (value >> 8) & 0xFF;                                       /* MSB */
+    buf[1] = value & 0xFF;                                              /* LSB */
+    if (MAX30205_IIC_WRITE(handle, reg, (uint8_t *)buf, 2) != 0)        /* write to register */
+    {
+        return 1;                                                       /* return error */
+    }
+    if (a_max30205_attach_read(handle, reg, &check) != 0)               /* read it back */
+    {
+        return 1;                                                       /* return error */
+    }
+    
+    return (check == value) ? 0 : 4;                                    /* check the value */
+}
+
+/**
+ * @brief      re-attach to a running chip and write only what differs
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[in]  shutdown 1 for the shutdown mode, 0 for continuous conversions
+ * @param[in]  low_threshold desired hysteresis register
+ * @param[in]  high_threshold desired overtemperature register
+ * @param[out] *report pointer to a max30205 attach report structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read or write failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 a written register did not read back
+ * @note       call it after max30205_init and the configuration setters, which only fill the register
+ *             mirror in the handle, the three registers are read back to back, the thresholds are written
+ *             before the configuration, an untouched configuration keeps the running conversion going
+ */
+uint8_t max30205_attach(max30205_handle_t *handle, uint8_t shutdown, int16_t low_threshold,
+                        int16_t high_threshold, max30205_attach_report_t *report)
+{
+    uint8_t res;
+    uint8_t conf;
+    uint8_t check;
+    
+    if ((handle == NULL) || (report == NULL))                                             /* check handle */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (handle->inited != 1)                                                              /* check handle initialization */
+    {
+        return 3;                                                                         /* return error */
+    }
+    
+    memset(report, 0, sizeof(max30205_attach_report_t));                                  /* clear the report */
+    if (MAX30205_IIC_READ(handle, MAX30205_REG_CONF, (uint8_t *)&report->conf, 1) != 0)   /* read conf */
+    {
+        MAX30205_DEBUG_PRINT(handle, "max30205: read conf failed.\n");                    /* read conf failed */
+        
+        return 1;                                                                         /* return error */
+    }
+    if (a_max30205_attach_read(handle, MAX30205_REG_THYST, &report->thyst) != 0)          /* read thyst */
+    {
+        MAX30205_DEBUG_PRINT(handle, "max30205: read thyst failed.\n");                   /* read thyst failed */
+        
+        return 1;                                                                         /* return error */
+    }
+    if (a_max30205_attach_read(handle, MAX30205_REG_TOS, &report->tos) != 0)              /* read tos */
+    {
+        MAX30205_DEBUG_PRINT(handle, "max30205: read tos failed.\n");                     /* read tos failed */
+        
+        return 1;                                                                         /* return error */
+    }
+    
+    if (report->thyst != low_threshold)                                                   /* hysteresis differs */
+    {
+        res = a_max30205_attach_write(handle, MAX30205_REG_THYST, low_threshold);         /* write thyst */
+        if (res != 0)
+        {
+            MAX30205_DEBUG_PRINT(handle, "max30205: write thyst failed.\n");              /* write thyst failed */
+            
+            return res;                                                                   /* return error */
+        }
+        report->changed |= MAX30205_ATTACH_CHANGED_THYST;                                 /* report it */
+    }
+    if (report->tos != high_threshold)                                                    /* overtemperature differs */
+    {
+        res = a_max30205_attach_write(handle, MAX30205_REG_TOS, high_threshold);          /* write tos */
+        if (res != 0)
+        {
+            MAX30205_DEBUG_PRINT(handle, "max30205: write tos failed.\n");                /* write tos failed */
+            
+            return res;                                                                   /* return error */
+        }
+        report->changed |= MAX30205_ATTACH_CHANGED_TOS;                                   /* report it */
+    }
+    conf = (uint8_t)((handle->reg & 0x7E) | ((shutdown != 0) ? 0x01 : 0x00));             /* desired conf */
+    if ((report->conf & 0x7F) != conf)                                                    /* configuration differs */
+    {
+        if (MAX30205_IIC_WRITE(handle, MAX30205_REG_CONF, (uint8_t *)&conf, 1) != 0)      /* write conf */
+        {
+            MAX30205_DEBUG_PRINT(handle, "max30205: write conf failed.\n");               /* write conf failed */
+            
+            return 1;                                                                     /* return error */
+        }
+        if (MAX30205_IIC_READ(handle, MAX30205_REG_CONF, (uint8_t *)&check, 1) != 0)      /* read it back */
+        {
+            MAX30205_DEBUG_PRINT(handle, "max30205: read conf failed.\n");                /* read conf failed */
+            
+            return 1;                                                                     /* return error */
+        }
+        if ((check & 0x7F) != conf)                                                       /* check the value */
+        {
+            MAX30205_DEBUG_PRINT(handle, "max30205: write conf failed.\n");               /* write conf failed */
+            
+            return 4;                                                                     /* return error */
+        }
+        report->changed |= MAX30205_ATTACH_CHANGED_CONF;                                  /* report it */
+    }
+    handle->reg = conf & 0x7E;                                                            /* mirror conf without mode bits */
+    
+    return 0;                                                                             /* success return 0 */
+}
@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_attach.h
+ * @brief     driver max30205 attach header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MAX30205_ATTACH_H
+#define DRIVER_MAX30205_ATTACH_H
+
+#include "driver_max30205.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup max30205_attach_driver
+ * @{
+ */
+
+/**
+ * @brief max30205 attach changed enumeration definition
+ */
+typedef enum
+{
+    MAX30205_ATTACH_CHANGED_CONF  = 0x01,        /**< configuration register rewritten */
+    MAX30205_ATTACH_CHANGED_THYST = 0x02,        /**< hysteresis register rewritten */
+    MAX30205_ATTACH_CHANGED_TOS   = 0x04,        /**< overtemperature register rewritten */
+} max30205_attach_changed_t;
+
+/**
+ * @brief max30205 attach report structure definition
+ */
+typedef struct max30205_attach_report_s
+{
+    uint8_t changed;        /**< mask of max30205_attach_changed_t, 0 when the chip already matched */
+    uint8_t conf;           /**< configuration found on the chip */
+    int16_t thyst;          /**< hysteresis found on the chip */
+    int16_t tos;            /**< overtemperature found on the chip */
+} max30205_attach_report_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup max30205_attach_driver max30205 attach driver function
+ * @brief    max30205 attach driver modules
+ * @ingroup  max30205_driver
+ * @{
+ */
+
+/**
+ * @brief      re-attach to a running chip and write only what differs
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[in]  shutdown 1 for the shutdown mode, 0 for continuous conversions
+ * @param[in]  low_threshold desired hysteresis register
+ * @param[in]  high_threshold desired overtemperature register
+ * @param[out] *report pointer to a max30205 attach report structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read or write failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 a written register did not read back
+ * @note       call it after max30205_init and the configuration setters, which only fill the register
+ *             mirror in the handle, the three registers are read back to back, the thresholds are written
+ *             before the configuration, an untouched configuration keeps the running conversion going
+ */
+uint8_t max30205_attach(max30205_handle_t *handle, uint8_t shutdown, int16_t low_threshold,
+                        int16_t high_threshold, max30205_attach_report_t *report);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
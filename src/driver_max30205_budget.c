@@ -0,0 +1,324 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_budget.c
+ * @brief     driver max30205 budget source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_max30205_budget.h"
+
+/**
+ * @brief token scale definition
+ */
+#define MAX30205_BUDGET_SCALE        1000000ULL        /**< one bus microsecond */
+
+/**
+ * @brief     refill the bucket
+ * @param[in] *budget pointer to a max30205 budget structure
+ * @note      none
+ */
+static void a_max30205_budget_refill(max30205_budget_t *budget)
+{
+    uint64_t now;
+    
+    now = budget->timestamp_us();                                        /* get time */
+    budget->tokens += (now - budget->last_us) * budget->rate_ppm;        /* add tokens */
+    if (budget->tokens > budget->burst)                                  /* check the depth */
+    {
+        budget->tokens = budget->burst;                                  /* full */
+    }
+    budget->last_us = now;                                               /* save time */
+}
+
+/**
+ * @brief     init the bus budget
+ * @param[in] *budget pointer to a max30205 budget structure
+ * @param[in] clock_hz bus clock
+ * @param[in] occupancy budgeted bus occupancy in percent
+ * @param[in] burst_us bus time that can be spent at once, it must not be 0
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 param is invalid
+ * @note      the bucket starts full
+ */
+uint8_t max30205_budget_init(max30205_budget_t *budget, uint32_t clock_hz, float occupancy, uint32_t burst_us)
+{
+    if (budget == NULL)                                                        /* check handle */
+    {
+        return 2;                                                              /* return error */
+    }
+    if (budget->timestamp_us == NULL)                                          /* check timestamp_us */
+    {
+        return 3;                                                              /* return error */
+    }
+    if ((clock_hz == 0) || (occupancy <= 0.0f) || (occupancy > 100.0f))        /* check the param */
+    {
+        return 4;                                                              /* return error */
+    }
+    if (burst_us == 0)                                                         /* an empty bucket never throttles */
+    {
+        return 4;                                                              /* return error */
+    }
+    
+    budget->clock_hz = clock_hz;                                               /* set clock */
+    budget->rate_ppm = (uint32_t)(occupancy * 10000.0f);                       /* set rate */
+    budget->burst = (uint64_t)burst_us * MAX30205_BUDGET_SCALE;                /* set depth */
+    budget->tokens = budget->burst;                                            /* full bucket */
+    budget->last_us = budget->timestamp_us();                                  /* refill time */
+    budget->start_us = budget->last_us;                                        /* report start */
+    budget->used_us = 0;                                                       /* clear used time */
+    budget->throttled = 0;                                                     /* clear throttled */
+    budget->inited = 1;                                                        /* flag inited */
+    
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief     set the budget as a byte rate
+ * @param[in] *budget pointer to a max30205 budget structure
+ * @param[in] bytes_per_second budgeted bytes per second
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 budget is not inited
+ *            - 4 rate is over the bus capacity
+ * @note      every byte takes nine bus clocks
+ */
+uint8_t max30205_budget_set_rate(max30205_budget_t *budget, uint32_t bytes_per_second)
+{
+    uint64_t ppm;
+    
+    if (budget == NULL)                                                                /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (budget->inited != 1)                                                           /* check budget */
+    {
+        return 3;                                                                      /* return error */
+    }
+    
+    ppm = (uint64_t)bytes_per_second * 9 * MAX30205_BUDGET_SCALE / budget->clock_hz;   /* bus share */
+    if ((ppm == 0) || (ppm > MAX30205_BUDGET_SCALE))                                   /* check the rate */
+    {
+        return 4;                                                                      /* return error */
+    }
+    a_max30205_budget_refill(budget);                                                  /* refill at the old rate */
+    budget->rate_ppm = (uint32_t)ppm;                                                  /* set rate */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     get the bus time of a transaction
+ * @param[in] *budget pointer to a max30205 budget structure
+ * @param[in] read 1 for a register read, 0 for a register write
+ * @param[in] len payload length
+ * @return    bus time in microseconds
+ * @note      start, address, register, repeated start and stop are counted
+ */
+uint32_t max30205_budget_cost_us(max30205_budget_t *budget, uint8_t read, uint16_t len)
+{
+    uint32_t bits;
+    
+    if ((budget == NULL) || (budget->clock_hz == 0))                                           /* check handle */
+    {
+        return 0;                                                                              /* no cost */
+    }
+    
+    bits = 1 + 9 + 9 + (uint32_t)len * 9 + 1;                                                  /* start, addr, reg, data, stop */
+    if (read != 0)                                                                             /* register read */
+    {
+        bits += 1 + 9;                                                                         /* repeated start, addr */
+    }
+    
+    return (uint32_t)(((uint64_t)bits * 1000000 + budget->clock_hz - 1) / budget->clock_hz);   /* round up */
+}
+
+/**
+ * @brief      take tokens for a transaction
+ * @param[in]  *budget pointer to a max30205 budget structure
+ * @param[in]  cost_us bus time of the transaction
+ * @param[out] *wait_us pointer to a wait time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 budget is not inited
+ *             - 4 budget is exhausted
+ * @note       retry after wait_us when it returns 4
+ */
+uint8_t max30205_budget_take(max30205_budget_t *budget, uint32_t cost_us, uint32_t *wait_us)
+{
+    uint64_t need;
+    
+    if ((budget == NULL) || (wait_us == NULL))                                     /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (budget->inited != 1)                                                       /* check budget */
+    {
+        return 3;                                                                  /* return error */
+    }
+    
+    a_max30205_budget_refill(budget);                                              /* refill */
+    need = (uint64_t)cost_us * MAX30205_BUDGET_SCALE;                              /* needed tokens */
+    if ((budget->tokens < need) && (budget->tokens < budget->burst))               /* a full bucket lets one oversized transaction through */
+    {
+        *wait_us = (uint32_t)((need - budget->tokens + budget->rate_ppm - 1)
+                              / budget->rate_ppm);                                 /* refill time */
+        budget->throttled++;                                                       /* throttled */
+        
+        return 4;                                                                  /* return error */
+    }
+    budget->tokens = (budget->tokens > need) ? (budget->tokens - need) : 0;        /* spend tokens */
+    budget->used_us += cost_us;                                                    /* add used time */
+    *wait_us = 0;                                                                  /* no wait */
+    
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief      read data in the continuous mode within the budget
+ * @param[in]  *budget pointer to a max30205 budget structure
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *s pointer to a converted data buffer
+ * @param[out] *wait_us pointer to a wait time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 continuous read failed
+ *             - 2 handle is NULL
+ *             - 3 budget is not inited
+ *             - 4 budget is exhausted
+ * @note       no bus transaction is issued when it returns 4
+ */
+uint8_t max30205_budget_continuous_read(max30205_budget_t *budget, max30205_handle_t *handle,
+                                        int16_t *raw, float *s, uint32_t *wait_us)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                                   /* check handle */
+    {
+        return 2;                                                                         /* return error */
+    }
+    
+    res = max30205_budget_take(budget, max30205_budget_cost_us(budget, 1, 2), wait_us);   /* two bytes read */
+    if (res != 0)                                                                         /* check result */
+    {
+        return res;                                                                       /* return error */
+    }
+    
+    return max30205_continuous_read(handle, raw, s);                                      /* read */
+}
+
+#if (MAX30205_CONFIG_SINGLE_READ == 1)
+/**
+ * @brief      read data in the single mode within the budget
+ * @param[in]  *budget pointer to a max30205 budget structure
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *s pointer to a converted data buffer
+ * @param[out] *wait_us pointer to a wait time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read failed
+ *             - 2 handle is NULL
+ *             - 3 budget is not inited
+ *             - 4 budget is exhausted
+ * @note       the conversion wait does not use the bus and is not charged
+ */
+uint8_t max30205_budget_single_read(max30205_budget_t *budget, max30205_handle_t *handle,
+                                    int16_t *raw, float *s, uint32_t *wait_us)
+{
+    uint32_t cost;
+    uint8_t res;
+    
+    if (handle == NULL)                                       /* check handle */
+    {
+        return 2;                                             /* return error */
+    }
+    
+    cost = max30205_budget_cost_us(budget, 0, 1)
+           + max30205_budget_cost_us(budget, 1, 2);           /* conf write and two bytes read */
+    res = max30205_budget_take(budget, cost, wait_us);        /* take tokens */
+    if (res != 0)                                             /* check result */
+    {
+        return res;                                           /* return error */
+    }
+    
+    return max30205_single_read(handle, raw, s);              /* read */
+}
+#endif
+
+/**
+ * @brief      get the actual and budgeted occupancy
+ * @param[in]  *budget pointer to a max30205 budget structure
+ * @param[out] *actual pointer to a used occupancy buffer in percent
+ * @param[out] *budgeted pointer to a budgeted occupancy buffer in percent
+ * @param[out] *throttled pointer to a throttled transaction number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 budget is not inited
+ * @note       the report window restarts after each call
+ */
+uint8_t max30205_budget_get_report(max30205_budget_t *budget, float *actual, float *budgeted, uint32_t *throttled)
+{
+    uint64_t now;
+    
+    if ((budget == NULL) || (actual == NULL) || (budgeted == NULL) || (throttled == NULL))   /* check handle */
+    {
+        return 2;                                                                            /* return error */
+    }
+    if (budget->inited != 1)                                                                 /* check budget */
+    {
+        return 3;                                                                            /* return error */
+    }
+    
+    now = budget->timestamp_us();                                                            /* get time */
+    if (now > budget->start_us)                                                              /* check the window */
+    {
+        *actual = (float)budget->used_us * 100.0f / (float)(now - budget->start_us);         /* used occupancy */
+    }
+    else
+    {
+        *actual = 0.0f;                                                                      /* empty window */
+    }
+    *budgeted = (float)budget->rate_ppm / 10000.0f;                                          /* budgeted occupancy */
+    *throttled = budget->throttled;                                                          /* throttled number */
+    budget->start_us = now;                                                                  /* restart the window */
+    budget->used_us = 0;                                                                     /* clear used time */
+    budget->throttled = 0;                                                                   /* clear throttled */
+    
+    return 0;                                                                                /* success return 0 */
+}
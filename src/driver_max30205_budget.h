@@ -0,0 +1,219 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_budget.h
+ * @brief     driver max30205 budget header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MAX30205_BUDGET_H
+#define DRIVER_MAX30205_BUDGET_H
+
+#include "driver_max30205.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup max30205_budget_driver
+ * @{
+ */
+
+/**
+ * @brief max30205 budget structure definition
+ * @note  tokens are bus time in microseconds scaled by 1000000
+ */
+typedef struct max30205_budget_s
+{
+    uint64_t (*timestamp_us)(void);        /**< point to a timestamp_us function address */
+    uint32_t clock_hz;                     /**< bus clock */
+    uint32_t rate_ppm;                     /**< budgeted occupancy in parts per million */
+    uint64_t burst;                        /**< bucket depth */
+    uint64_t tokens;                       /**< tokens in the bucket */
+    uint64_t last_us;                      /**< last refill time */
+    uint64_t start_us;                     /**< report window start */
+    uint64_t used_us;                      /**< bus time used in the report window */
+    uint32_t throttled;                    /**< throttled transaction number */
+    uint8_t inited;                        /**< inited flag */
+} max30205_budget_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup max30205_budget_link_driver max30205 budget link driver function
+ * @brief    max30205 budget link driver modules
+ * @ingroup  max30205_budget_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize max30205_budget_t structure
+ * @param[in] BUDGET pointer to a max30205 budget structure
+ * @param[in] STRUCTURE max30205_budget_t
+ * @note      none
+ */
+#define DRIVER_MAX30205_BUDGET_LINK_INIT(BUDGET, STRUCTURE)         memset(BUDGET, 0, sizeof(STRUCTURE))
+
+/**
+ * @brief     link timestamp_us function
+ * @param[in] BUDGET pointer to a max30205 budget structure
+ * @param[in] FUC pointer to a timestamp_us function address
+ * @note      it returns a free running microsecond counter
+ */
+#define DRIVER_MAX30205_BUDGET_LINK_TIMESTAMP_US(BUDGET, FUC)       (BUDGET)->timestamp_us = FUC
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup max30205_budget_driver max30205 budget driver function
+ * @brief    max30205 budget driver modules
+ * @ingroup  max30205_driver
+ * @{
+ */
+
+/**
+ * @brief     init the bus budget
+ * @param[in] *budget pointer to a max30205 budget structure
+ * @param[in] clock_hz bus clock
+ * @param[in] occupancy budgeted bus occupancy in percent
+ * @param[in] burst_us bus time that can be spent at once, it must not be 0
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 param is invalid
+ * @note      the bucket starts full
+ */
+uint8_t max30205_budget_init(max30205_budget_t *budget, uint32_t clock_hz, float occupancy, uint32_t burst_us);
+
+/**
+ * @brief     set the budget as a byte rate
+ * @param[in] *budget pointer to a max30205 budget structure
+ * @param[in] bytes_per_second budgeted bytes per second
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 budget is not inited
+ *            - 4 rate is over the bus capacity
+ * @note      every byte takes nine bus clocks
+ */
+uint8_t max30205_budget_set_rate(max30205_budget_t *budget, uint32_t bytes_per_second);
+
+/**
+ * @brief     get the bus time of a transaction
+ * @param[in] *budget pointer to a max30205 budget structure
+ * @param[in] read 1 for a register read, 0 for a register write
+ * @param[in] len payload length
+ * @return    bus time in microseconds
+ * @note      start, address, register, repeated start and stop are counted
+ */
+uint32_t max30205_budget_cost_us(max30205_budget_t *budget, uint8_t read, uint16_t len);
+
+/**
+ * @brief      take tokens for a transaction
+ * @param[in]  *budget pointer to a max30205 budget structure
+ * @param[in]  cost_us bus time of the transaction
+ * @param[out] *wait_us pointer to a wait time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 budget is not inited
+ *             - 4 budget is exhausted
+ * @note       retry after wait_us when it returns 4
+ */
+uint8_t max30205_budget_take(max30205_budget_t *budget, uint32_t cost_us, uint32_t *wait_us);
+
+/**
+ * @brief      read data in the continuous mode within the budget
+ * @param[in]  *budget pointer to a max30205 budget structure
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *s pointer to a converted data buffer
+ * @param[out] *wait_us pointer to a wait time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 continuous read failed
+ *             - 2 handle is NULL
+ *             - 3 budget is not inited
+ *             - 4 budget is exhausted
+ * @note       no bus transaction is issued when it returns 4
+ */
+uint8_t max30205_budget_continuous_read(max30205_budget_t *budget, max30205_handle_t *handle,
+                                        int16_t *raw, float *s, uint32_t *wait_us);
+
+#if (MAX30205_CONFIG_SINGLE_READ == 1)
+/**
+ * @brief      read data in the single mode within the budget
+ * @param[in]  *budget pointer to a max30205 budget structure
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *s pointer to a converted data buffer
+ * @param[out] *wait_us pointer to a wait time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read failed
+ *             - 2 handle is NULL
+ *             - 3 budget is not inited
+ *             - 4 budget is exhausted
+ * @note       the conversion wait does not use the bus and is not charged
+ */
+uint8_t max30205_budget_single_read(max30205_budget_t *budget, max30205_handle_t *handle,
+                                    int16_t *raw, float *s, uint32_t *wait_us);
+#endif
+
+/**
+ * @brief      get the actual and budgeted occupancy
+ * @param[in]  *budget pointer to a max30205 budget structure
+ * @param[out] *actual pointer to a used occupancy buffer in percent
+ * @param[out] *budgeted pointer to a budgeted occupancy buffer in percent
+ * @param[out] *throttled pointer to a throttled transaction number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 budget is not inited
+ * @note       the report window restarts after each call
+ */
+uint8_t max30205_budget_get_report(max30205_budget_t *budget, float *actual, float *budgeted, uint32_t *throttled);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,253 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_coalesce.c
+ * @brief     driver max30205 coalesce source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_max30205_coalesce.h"
+
+/**
+ * @brief chip register definition
+ */
+#define MAX30205_REG_CONF          0x01        /**< configuration register */
+
+/**
+ * @brief     write a fault queue to the chip
+ * @param[in] *coalesce pointer to a max30205 coalesce structure
+ * @param[in] fault_queue fault queue
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the conf register is read, modified and written, so the chip keeps its shutdown or
+ *            one-shot mode, the register mirror of the handle only changes when the write succeeded
+ */
+static uint8_t a_max30205_coalesce_write_queue(max30205_coalesce_t *coalesce, max30205_fault_queue_t fault_queue)
+{
+    max30205_handle_t *handle = coalesce->handle;
+    uint8_t reg;
+    
+    if (MAX30205_IIC_READ(handle, MAX30205_REG_CONF, (uint8_t *)&reg, 1) != 0)             /* read conf */
+    {
+        MAX30205_DEBUG_PRINT(handle, "max30205: read conf failed.\n");                    /* read conf failed */
+        
+        return 1;                                                                          /* return error */
+    }
+    reg = reg & (uint8_t)(~((3 << 3) | (1 << 7)));                                         /* clear fault queue and one-shot */
+    reg = (uint8_t)(reg | ((fault_queue & 0x03) << 3));                                    /* set fault queue */
+    if (MAX30205_IIC_WRITE(handle, MAX30205_REG_CONF, (uint8_t *)&reg, 1) != 0)            /* write conf */
+    {
+        MAX30205_DEBUG_PRINT(handle, "max30205: write conf failed.\n");                   /* write conf failed */
+        
+        return 1;                                                                          /* return error */
+    }
+    handle->reg = handle->reg & (uint8_t)(~(3 << 3));                                      /* clear the mirror */
+    handle->reg = (uint8_t)(handle->reg | ((fault_queue & 0x03) << 3));                    /* commit the mirror */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     initialize the coalesce structure
+ * @param[in] *coalesce pointer to a max30205 coalesce structure
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] window_ms minimal interval between two events in ms
+ * @param[in] storm_edges os edges merged into one event that start a storm
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 storm edges is invalid
+ * @note      storm_edges > 0
+ */
+uint8_t max30205_coalesce_init(max30205_coalesce_t *coalesce, max30205_handle_t *handle,
+                               uint32_t window_ms, uint32_t storm_edges)
+{
+    if ((coalesce == NULL) || (handle == NULL))              /* check handle */
+    {
+        return 2;                                            /* return error */
+    }
+    if (storm_edges == 0)                                    /* check storm edges */
+    {
+        return 4;                                            /* return error */
+    }
+    
+    memset(coalesce, 0, sizeof(max30205_coalesce_t));        /* clear the structure */
+    coalesce->handle = handle;                               /* set the handle */
+    coalesce->window_ms = window_ms;                         /* set the window */
+    coalesce->storm_edges = storm_edges;                     /* set the storm edges */
+    coalesce->storm_queue = MAX30205_FAULT_QUEUE_6;          /* default storm fault queue */
+    coalesce->saved_queue = MAX30205_FAULT_QUEUE_1;          /* default saved fault queue */
+    
+    return 0;                                                /* success return 0 */
+}
+
+/**
+ * @brief     set the fault queue used during a storm
+ * @param[in] *coalesce pointer to a max30205 coalesce structure
+ * @param[in] enable bool value
+ * @param[in] fault_queue fault queue used during a storm
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      the fault queue is written only when a storm starts and the previous one
+ *            is restored when the storm ends, both by a read-modify-write of the conf register
+ *            that keeps the shutdown or one-shot mode of the chip, a failed write leaves the
+ *            edges pending and the mirror untouched, so the next process call retries it
+ */
+uint8_t max30205_coalesce_set_storm_fault_queue(max30205_coalesce_t *coalesce, uint8_t enable,
+                                                max30205_fault_queue_t fault_queue)
+{
+    if (coalesce == NULL)                                        /* check handle */
+    {
+        return 2;                                                /* return error */
+    }
+    
+    coalesce->storm_queue_enable = (enable != 0) ? 1 : 0;        /* set enable */
+    coalesce->storm_queue = fault_queue;                         /* set fault queue */
+    
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief     irq handler
+ * @param[in] *coalesce pointer to a max30205 coalesce structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      call it in the os pin edge isr, it only counts the edge and never touches the bus
+ */
+uint8_t max30205_coalesce_irq_handler(max30205_coalesce_t *coalesce)
+{
+    if (coalesce == NULL)        /* check handle */
+    {
+        return 2;                /* return error */
+    }
+    
+    coalesce->edges++;           /* count the edge */
+    
+    return 0;                    /* success return 0 */
+}
+
+/**
+ * @brief      process the pending os edges
+ * @param[in]  *coalesce pointer to a max30205 coalesce structure
+ * @param[in]  timestamp_ms current timestamp in ms
+ * @param[out] *event pointer to a coalesce event buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 process failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       call it periodically in the main loop, all edges that arrive within one window
+ *             are merged into a single event with one temperature read and event->count
+ *             is 0 when no event is produced
+ */
+uint8_t max30205_coalesce_process(max30205_coalesce_t *coalesce, uint32_t timestamp_ms,
+                                  max30205_coalesce_event_t *event)
+{
+    uint8_t res;
+    uint32_t edges;
+    uint32_t pending;
+    
+    if ((coalesce == NULL) || (event == NULL))                                             /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (coalesce->handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (coalesce->handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    event->count = 0;                                                                      /* no event */
+    event->storm = coalesce->storm;                                                        /* set storm flag */
+    if ((coalesce->started != 0) &&
+        ((uint32_t)(timestamp_ms - coalesce->last_ms) < coalesce->window_ms))              /* rate limit */
+    {
+        return 0;                                                                          /* success return 0 */
+    }
+    
+    edges = coalesce->edges;                                                               /* snapshot the isr counter */
+    pending = edges - coalesce->handled;                                                   /* get the pending edges */
+    if (pending == 0)                                                                      /* quiet window */
+    {
+        if (coalesce->storm != 0)                                                          /* storm is over */
+        {
+            if (coalesce->storm_queue_enable != 0)                                         /* restore the fault queue */
+            {
+                res = a_max30205_coalesce_write_queue(coalesce, coalesce->saved_queue);    /* restore fault queue */
+                if (res != 0)                                                              /* check the result */
+                {
+                    return 1;                                                              /* retry at the next call */
+                }
+            }
+            coalesce->storm = 0;                                                           /* clear storm flag */
+            event->storm = 0;                                                              /* clear storm flag */
+        }
+        
+        return 0;                                                                          /* success return 0 */
+    }
+    
+    if ((coalesce->storm == 0) && (pending >= coalesce->storm_edges))                      /* storm starts */
+    {
+        if (coalesce->storm_queue_enable != 0)                                             /* raise the fault queue */
+        {
+            res = max30205_get_fault_queue(coalesce->handle, &coalesce->saved_queue);      /* save fault queue */
+            if (res != 0)                                                                  /* check the result */
+            {
+                return 1;                                                                  /* return error */
+            }
+            res = a_max30205_coalesce_write_queue(coalesce, coalesce->storm_queue);        /* set storm fault queue */
+            if (res != 0)                                                                  /* check the result */
+            {
+                return 1;                                                                  /* edges stay pending */
+            }
+        }
+        coalesce->storm = 1;                                                               /* set storm flag */
+    }
+    
+    res = max30205_continuous_read(coalesce->handle, &event->raw, &event->s);              /* one read for the whole burst */
+    if (res != 0)                                                                          /* check the result */
+    {
+        return 1;                                                                          /* edges stay pending */
+    }
+    coalesce->handled = edges;                                                             /* merge the pending edges */
+    coalesce->last_ms = timestamp_ms;                                                      /* save the timestamp */
+    coalesce->started = 1;                                                                 /* set started */
+    event->count = pending;                                                                /* set the merged edges */
+    event->storm = coalesce->storm;                                                        /* set storm flag */
+    
+    return 0;                                                                              /* success return 0 */
+}
@@ -0,0 +1,157 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_coalesce.h
+ * @brief     driver max30205 coalesce header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MAX30205_COALESCE_H
+#define DRIVER_MAX30205_COALESCE_H
+
+#include "driver_max30205.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup max30205_coalesce_driver
+ * @{
+ */
+
+/**
+ * @brief max30205 coalesce event structure definition
+ */
+typedef struct max30205_coalesce_event_s
+{
+    uint32_t count;        /**< merged os edges, 0 means no event */
+    int16_t raw;           /**< raw temperature */
+    float s;               /**< converted temperature */
+    uint8_t storm;         /**< storm flag */
+} max30205_coalesce_event_t;
+
+/**
+ * @brief max30205 coalesce structure definition
+ */
+typedef struct max30205_coalesce_s
+{
+    max30205_handle_t *handle;                 /**< max30205 handle */
+    uint32_t window_ms;                        /**< minimal interval between two events */
+    uint32_t storm_edges;                      /**< edges in one event that start a storm */
+    uint8_t storm_queue_enable;                /**< raise the fault queue during a storm */
+    max30205_fault_queue_t storm_queue;        /**< fault queue used during a storm */
+    max30205_fault_queue_t saved_queue;        /**< fault queue restored after a storm */
+    volatile uint32_t edges;                   /**< os edges counted by the irq handler */
+    uint32_t handled;                          /**< os edges already merged into events */
+    uint32_t last_ms;                          /**< timestamp of the last event */
+    uint8_t started;                           /**< started flag */
+    uint8_t storm;                             /**< storm flag */
+} max30205_coalesce_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup max30205_coalesce_driver max30205 coalesce driver function
+ * @brief    max30205 coalesce driver modules
+ * @ingroup  max30205_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize the coalesce structure
+ * @param[in] *coalesce pointer to a max30205 coalesce structure
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] window_ms minimal interval between two events in ms
+ * @param[in] storm_edges os edges merged into one event that start a storm
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 storm edges is invalid
+ * @note      storm_edges > 0
+ */
+uint8_t max30205_coalesce_init(max30205_coalesce_t *coalesce, max30205_handle_t *handle,
+                               uint32_t window_ms, uint32_t storm_edges);
+
+/**
+ * @brief     set the fault queue used during a storm
+ * @param[in] *coalesce pointer to a max30205 coalesce structure
+ * @param[in] enable bool value
+ * @param[in] fault_queue fault queue used during a storm
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      the fault queue is written only when a storm starts and the previous one
+ *            is restored when the storm ends, both by a read-modify-write of the conf register
+ *            that keeps the shutdown or one-shot mode of the chip, a failed write leaves the
+ *            edges pending and the mirror untouched, so the next process call retries it
+ */
+uint8_t max30205_coalesce_set_storm_fault_queue(max30205_coalesce_t *coalesce, uint8_t enable,
+                                                max30205_fault_queue_t fault_queue);
+
+/**
+ * @brief     irq handler
+ * @param[in] *coalesce pointer to a max30205 coalesce structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      call it in the os pin edge isr, it only counts the edge and never touches the bus
+ */
+uint8_t max30205_coalesce_irq_handler(max30205_coalesce_t *coalesce);
+
+/**
+ * @brief      process the pending os edges
+ * @param[in]  *coalesce pointer to a max30205 coalesce structure
+ * @param[in]  timestamp_ms current timestamp in ms
+ * @param[out] *event pointer to a coalesce event buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 process failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       call it periodically in the main loop, all edges that arrive within one window
+ *             are merged into a single event with one temperature read and event->count
+ *             is 0 when no event is produced
+ */
+uint8_t max30205_coalesce_process(max30205_coalesce_t *coalesce, uint32_t timestamp_ms,
+                                  max30205_coalesce_event_t *event);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,126 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_config.h
+ * @brief     driver max30205 config header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MAX30205_CONFIG_H
+#define DRIVER_MAX30205_CONFIG_H
+
+/**
+ * @addtogroup max30205_driver
+ * @{
+ */
+
+/**
+ * @brief build profile definition
+ * @note  every switch can be overridden with -D on the command line or by editing this file,
+ *        the defaults build the full driver
+ */
+
+/**
+ * @brief one-shot read switch
+ * @note  0 removes max30205_single_read and the module wrappers built on it,
+ *        the shot example and the read test still need it
+ */
+#ifndef MAX30205_CONFIG_SINGLE_READ
+    #define MAX30205_CONFIG_SINGLE_READ       1
+#endif
+
+/**
+ * @brief threshold switch
+ * @note  0 removes the interrupt low and high threshold set and get functions
+ */
+#ifndef MAX30205_CONFIG_THRESHOLD
+    #define MAX30205_CONFIG_THRESHOLD         1
+#endif
+
+/**
+ * @brief extended format switch
+ * @note  0 removes the extended format conversions and max30205_set_data_format rejects it
+ */
+#ifndef MAX30205_CONFIG_EXTENDED_FORMAT
+    #define MAX30205_CONFIG_EXTENDED_FORMAT   1
+#endif
+
+/**
+ * @brief debug string switch
+ * @note  0 removes every driver debug string, debug_print is then neither checked nor called
+ */
+#ifndef MAX30205_CONFIG_DEBUG_PRINT
+    #define MAX30205_CONFIG_DEBUG_PRINT       1
+#endif
+
+/**
+ * @brief information switch
+ * @note  0 removes max30205_info and its string table
+ */
+#ifndef MAX30205_CONFIG_INFO
+    #define MAX30205_CONFIG_INFO              1
+#endif
+
+/**
+ * @brief shared bus operation switch
+ * @note  1 makes every handle point at a shared max30205_bus_t, a const operation table plus a
+ *        per-bus context, instead of carrying its own function pointers, the classic link macros
+ *        still work and put every handle linked that way on one process-wide bus, so all inited
+ *        classic handles must link the same functions
+ */
+#ifndef MAX30205_CONFIG_SHARED_OPS
+    #define MAX30205_CONFIG_SHARED_OPS        0
+#endif
+
+/**
+ * @brief group capacity definition
+ * @note  the largest number of sensors handled as one group, it sizes every static per-sensor
+ *        table and the bus only holds 32 addresses
+ */
+#ifndef MAX30205_CONFIG_GROUP_MAX
+    #define MAX30205_CONFIG_GROUP_MAX         32
+#endif
+
+/**
+ * @brief driver debug print definition
+ * @note  none
+ */
+#if (MAX30205_CONFIG_DEBUG_PRINT == 1)
+    #define MAX30205_DEBUG_PRINT(HANDLE, ...)   MAX30205_OPS(HANDLE)->debug_print(__VA_ARGS__)
+#else
+    #define MAX30205_DEBUG_PRINT(HANDLE, ...)   ((void)0)
+#endif
+
+/**
+ * @}
+ */
+
+#endif
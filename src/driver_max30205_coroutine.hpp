@@ -0,0 +1,552 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_coroutine.hpp
+ * @brief     driver max30205 coroutine header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MAX30205_COROUTINE_HPP
+#define DRIVER_MAX30205_COROUTINE_HPP
+
+#if !defined(__cplusplus) || (__cplusplus < 202002L)
+    #error "driver_max30205_coroutine.hpp needs c++20 coroutines, build with -std=c++20"
+#endif
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "driver_max30205_async.h"
+
+/**
+ * @defgroup max30205_coroutine_driver max30205 coroutine driver function
+ * @brief    max30205 coroutine driver modules
+ * @ingroup  max30205_driver
+ * @note     it is c++20 only, -std=c++17 and older are rejected at compile time, msvc needs
+ *           /Zc:__cplusplus to report the standard
+ * @{
+ */
+
+namespace max30205
+{
+
+/**
+ * @brief max30205 coroutine result structure definition
+ */
+struct result
+{
+    uint8_t res = 1;        /**< 0 success, 1 bus failed, 2 handle is NULL, 3 not initialized, 4 request is busy */
+    int16_t raw = 0;        /**< raw temperature or threshold */
+    float s = 0.0f;         /**< converted temperature in degrees celsius */
+};
+
+/**
+ * @brief max30205 executor interface
+ * @note  post() receives every coroutine resumed by a bus completion, it is called from the
+ *        completion context of the async bus hooks and must be thread safe if they are
+ */
+class executor
+{
+    public:
+        virtual ~executor() = default;
+        
+        /**
+         * @brief     schedule a coroutine
+         * @param[in] h coroutine to resume
+         * @note      none
+         */
+        virtual void post(std::coroutine_handle<> h) = 0;
+};
+
+/**
+ * @brief max30205 inline executor
+ * @note  it resumes the coroutine directly in the completion context
+ */
+class inline_executor final : public executor
+{
+    public:
+        void post(std::coroutine_handle<> h) override
+        {
+            h.resume();
+        }
+};
+
+/**
+ * @brief max30205 bus binding
+ * @note  one bus couples the non-blocking hooks with the executor that resumes the waiters,
+ *        any number of handles can share it
+ */
+class bus
+{
+    public:
+        /**
+         * @brief     construct a bus binding
+         * @param[in] async reference to the async bus hooks
+         * @param[in] exec reference to the executor
+         * @note      both must outlive every pending operation
+         */
+        bus(const max30205_async_t &async, executor &exec) noexcept : m_async(&async), m_exec(&exec) {}
+        
+        const max30205_async_t *async() const noexcept { return m_async; }
+        executor &exec() const noexcept { return *m_exec; }
+        
+    private:
+        const max30205_async_t *m_async;
+        executor *m_exec;
+};
+
+/**
+ * @brief max30205 operation awaiter
+ * @note  the request lives in the awaiting coroutine frame, nothing is allocated per operation
+ */
+class operation
+{
+    public:
+        operation(bus &b, max30205_handle_t &handle, max30205_async_type_t type, int16_t threshold = 0) noexcept
+            : m_bus(&b), m_handle(&handle), m_type(type), m_threshold(threshold) {}
+        
+        operation(const operation &) = delete;
+        operation &operator=(const operation &) = delete;
+        
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+        
+        bool await_suspend(std::coroutine_handle<> h) noexcept
+        {
+            uint8_t res;
+            
+            m_cont = h;
+            res = a_submit();
+            if (res != 0)
+            {
+                /* not submitted, resume at once with the error */
+                m_res = res;
+                
+                return false;
+            }
+            
+            /* the frame may already be resumed by another thread, do not touch this */
+            return true;
+        }
+        
+        result await_resume() const noexcept
+        {
+            result r;
+            
+            if (m_res != 0)
+            {
+                r.res = m_res;
+                
+                return r;
+            }
+            r.res = m_request.res;
+            r.raw = m_request.raw;
+            r.s = m_request.s;
+            
+            return r;
+        }
+        
+    private:
+        static void a_done(max30205_async_request_t *request) noexcept
+        {
+            operation *op = static_cast<operation *>(request->user);
+            
+            op->m_bus->exec().post(op->m_cont);
+        }
+        
+        uint8_t a_submit() noexcept
+        {
+            const max30205_async_t *a = m_bus->async();
+            
+            switch (m_type)
+            {
+                case MAX30205_ASYNC_TYPE_CONTINUOUS_READ :
+                    return max30205_async_continuous_read(a, m_handle, &m_request, a_done, this);
+                case MAX30205_ASYNC_TYPE_SINGLE_READ :
+                    return max30205_async_single_read(a, m_handle, &m_request, a_done, this);
+                case MAX30205_ASYNC_TYPE_START_CONTINUOUS_READ :
+                    return max30205_async_start_continuous_read(a, m_handle, &m_request, a_done, this);
+                case MAX30205_ASYNC_TYPE_STOP_CONTINUOUS_READ :
+                    return max30205_async_stop_continuous_read(a, m_handle, &m_request, a_done, this);
+                case MAX30205_ASYNC_TYPE_SET_LOW_THRESHOLD :
+                    return max30205_async_set_interrupt_low_threshold(a, m_handle, m_threshold, &m_request, a_done, this);
+                case MAX30205_ASYNC_TYPE_GET_LOW_THRESHOLD :
+                    return max30205_async_get_interrupt_low_threshold(a, m_handle, &m_request, a_done, this);
+                case MAX30205_ASYNC_TYPE_SET_HIGH_THRESHOLD :
+                    return max30205_async_set_interrupt_high_threshold(a, m_handle, m_threshold, &m_request, a_done, this);
+                case MAX30205_ASYNC_TYPE_GET_HIGH_THRESHOLD :
+                    return max30205_async_get_interrupt_high_threshold(a, m_handle, &m_request, a_done, this);
+                default :
+                    return 1;
+            }
+        }
+        
+        bus *m_bus;
+        max30205_handle_t *m_handle;
+        max30205_async_type_t m_type;
+        int16_t m_threshold;
+        uint8_t m_res = 0;
+        std::coroutine_handle<> m_cont;
+        max30205_async_request_t m_request{};
+};
+
+/**
+ * @brief     await a continuous read
+ * @param[in] b reference to a bus binding
+ * @param[in] handle reference to a max30205 handle structure
+ * @return    awaitable result
+ * @note      none
+ */
+inline operation read(bus &b, max30205_handle_t &handle) noexcept
+{
+    return operation(b, handle, MAX30205_ASYNC_TYPE_CONTINUOUS_READ);
+}
+
+/**
+ * @brief     await a one-shot conversion
+ * @param[in] b reference to a bus binding
+ * @param[in] handle reference to a max30205 handle structure
+ * @return    awaitable result
+ * @note      the 50 ms conversion runs on the timer_start hook, no thread is blocked
+ */
+inline operation single_read(bus &b, max30205_handle_t &handle) noexcept
+{
+    return operation(b, handle, MAX30205_ASYNC_TYPE_SINGLE_READ);
+}
+
+/**
+ * @brief     await a start continuous read
+ * @param[in] b reference to a bus binding
+ * @param[in] handle reference to a max30205 handle structure
+ * @return    awaitable result
+ * @note      none
+ */
+inline operation start_continuous_read(bus &b, max30205_handle_t &handle) noexcept
+{
+    return operation(b, handle, MAX30205_ASYNC_TYPE_START_CONTINUOUS_READ);
+}
+
+/**
+ * @brief     await a stop continuous read
+ * @param[in] b reference to a bus binding
+ * @param[in] handle reference to a max30205 handle structure
+ * @return    awaitable result
+ * @note      none
+ */
+inline operation stop_continuous_read(bus &b, max30205_handle_t &handle) noexcept
+{
+    return operation(b, handle, MAX30205_ASYNC_TYPE_STOP_CONTINUOUS_READ);
+}
+
+/**
+ * @brief     await a set interrupt low threshold
+ * @param[in] b reference to a bus binding
+ * @param[in] handle reference to a max30205 handle structure
+ * @param[in] threshold interrupt low threshold
+ * @return    awaitable result
+ * @note      none
+ */
+inline operation set_interrupt_low_threshold(bus &b, max30205_handle_t &handle, int16_t threshold) noexcept
+{
+    return operation(b, handle, MAX30205_ASYNC_TYPE_SET_LOW_THRESHOLD, threshold);
+}
+
+/**
+ * @brief     await a get interrupt low threshold
+ * @param[in] b reference to a bus binding
+ * @param[in] handle reference to a max30205 handle structure
+ * @return    awaitable result
+ * @note      none
+ */
+inline operation get_interrupt_low_threshold(bus &b, max30205_handle_t &handle) noexcept
+{
+    return operation(b, handle, MAX30205_ASYNC_TYPE_GET_LOW_THRESHOLD);
+}
+
+/**
+ * @brief     await a set interrupt high threshold
+ * @param[in] b reference to a bus binding
+ * @param[in] handle reference to a max30205 handle structure
+ * @param[in] threshold interrupt high threshold
+ * @return    awaitable result
+ * @note      none
+ */
+inline operation set_interrupt_high_threshold(bus &b, max30205_handle_t &handle, int16_t threshold) noexcept
+{
+    return operation(b, handle, MAX30205_ASYNC_TYPE_SET_HIGH_THRESHOLD, threshold);
+}
+
+/**
+ * @brief     await a get interrupt high threshold
+ * @param[in] b reference to a bus binding
+ * @param[in] handle reference to a max30205 handle structure
+ * @return    awaitable result
+ * @note      none
+ */
+inline operation get_interrupt_high_threshold(bus &b, max30205_handle_t &handle) noexcept
+{
+    return operation(b, handle, MAX30205_ASYNC_TYPE_GET_HIGH_THRESHOLD);
+}
+
+/**
+ * @brief max30205 lazy task
+ * @note  a task starts when it is awaited or start() is called, and resumes its awaiter
+ *        by symmetric transfer when it finishes
+ */
+template <typename T>
+class task
+{
+    public:
+        struct promise_type
+        {
+            T value{};
+            std::coroutine_handle<> cont;
+            std::atomic<bool> finished{false};
+            
+            task get_return_object() noexcept
+            {
+                return task(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+            
+            std::suspend_always initial_suspend() const noexcept
+            {
+                return {};
+            }
+            
+            auto final_suspend() const noexcept
+            {
+                struct final_awaiter
+                {
+                    bool await_ready() const noexcept { return false; }
+                    std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> h) const noexcept
+                    {
+                        std::coroutine_handle<> c = h.promise().cont;
+                        
+                        h.promise().finished.store(true, std::memory_order_release);
+                        
+                        return c ? c : std::noop_coroutine();
+                    }
+                    void await_resume() const noexcept {}
+                };
+                
+                return final_awaiter{};
+            }
+            
+            void return_value(T v) noexcept(std::is_nothrow_move_assignable_v<T>)
+            {
+                value = std::move(v);
+            }
+            
+            void unhandled_exception() const noexcept
+            {
+                std::terminate();
+            }
+        };
+        
+        task() noexcept = default;
+        task(task &&other) noexcept : m_h(std::exchange(other.m_h, {})) {}
+        task &operator=(task &&other) noexcept
+        {
+            if (this != &other)
+            {
+                a_destroy();
+                m_h = std::exchange(other.m_h, {});
+            }
+            
+            return *this;
+        }
+        task(const task &) = delete;
+        task &operator=(const task &) = delete;
+        ~task()
+        {
+            a_destroy();
+        }
+        
+        /**
+         * @brief  start a top level task
+         * @note   done() may be polled from any thread, read get() once it returns true
+         */
+        void start() noexcept
+        {
+            m_h.resume();
+        }
+        
+        bool done() const noexcept
+        {
+            return m_h && m_h.promise().finished.load(std::memory_order_acquire);
+        }
+        
+        T &get() noexcept
+        {
+            return m_h.promise().value;
+        }
+        
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+        
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> h) noexcept
+        {
+            m_h.promise().cont = h;
+            
+            return m_h;
+        }
+        
+        T await_resume() noexcept
+        {
+            return std::move(m_h.promise().value);
+        }
+        
+    private:
+        explicit task(std::coroutine_handle<promise_type> h) noexcept : m_h(h) {}
+        
+        void a_destroy() noexcept
+        {
+            if (m_h)
+            {
+                m_h.destroy();
+                m_h = {};
+            }
+        }
+        
+        std::coroutine_handle<promise_type> m_h;
+};
+
+namespace detail
+{
+
+struct when_all_state
+{
+    std::atomic<std::size_t> count{0};
+    std::coroutine_handle<> parent;
+};
+
+struct when_all_item
+{
+    struct promise_type
+    {
+        when_all_item get_return_object() const noexcept { return {}; }
+        std::suspend_never initial_suspend() const noexcept { return {}; }
+        std::suspend_never final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept { std::terminate(); }
+    };
+};
+
+template <typename T>
+when_all_item when_all_run(task<T> &t, T &out, when_all_state &state)
+{
+    out = co_await t;
+    if (state.count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        state.parent.resume();
+    }
+}
+
+template <typename T>
+class when_all_awaiter
+{
+    public:
+        when_all_awaiter(std::span<task<T>> tasks, std::vector<T> &out) noexcept : m_tasks(tasks), m_out(&out) {}
+        
+        bool await_ready() const noexcept
+        {
+            return m_tasks.empty();
+        }
+        
+        bool await_suspend(std::coroutine_handle<> h) noexcept
+        {
+            /* one extra count keeps the parent suspended until every task has been started */
+            m_state.count.store(m_tasks.size() + 1, std::memory_order_relaxed);
+            m_state.parent = h;
+            for (std::size_t i = 0; i < m_tasks.size(); i++)
+            {
+                when_all_run(m_tasks[i], (*m_out)[i], m_state);
+            }
+            
+            return m_state.count.fetch_sub(1, std::memory_order_acq_rel) != 1;
+        }
+        
+        void await_resume() const noexcept {}
+        
+    private:
+        std::span<task<T>> m_tasks;
+        std::vector<T> *m_out;
+        when_all_state m_state;
+};
+
+}
+
+/**
+ * @brief     run many tasks concurrently
+ * @param[in] tasks span of unstarted tasks
+ * @return    task producing the results in the order of the tasks
+ * @note      the tasks are in flight together, so a sweep over n sensors costs one bus round
+ *            trip per sensor instead of n blocked threads
+ */
+template <typename T>
+task<std::vector<T>> when_all(std::span<task<T>> tasks)
+{
+    std::vector<T> out(tasks.size());
+    
+    co_await detail::when_all_awaiter<T>(tasks, out);
+    
+    co_return out;
+}
+
+/**
+ * @brief     wrap an operation into a task
+ * @param[in] make callable returning an operation, e.g. [&] { return max30205::read(b, h); }
+ * @return    task producing the result
+ * @note      use it to build the task lists passed to when_all
+ */
+template <typename Make>
+task<result> make_task(Make make)
+{
+    co_return co_await make();
+}
+
+}
+
+/**
+ * @}
+ */
+
+#endif
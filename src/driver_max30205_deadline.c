@@ -0,0 +1,294 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_deadline.c
+ * @brief     driver max30205 deadline source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_max30205_deadline.h"
+
+/**
+ * @brief chip register definition
+ */
+#define MAX30205_REG_TEMP        0x00        /**< temperature register */
+#define MAX30205_REG_CONF        0x01        /**< configuration register */
+
+/**
+ * @brief chip conversion definition
+ */
+#define CONVERSION_TIME_MS       50          /**< max conversion time */
+
+/**
+ * @brief     get the time left
+ * @param[in] *deadline pointer to a max30205 deadline structure
+ * @param[in] deadline_us absolute deadline
+ * @param[in] need_us time the next step needs
+ * @return    remaining time, 0 means the step does not fit
+ * @note      none
+ */
+static uint32_t a_max30205_deadline_remaining(max30205_deadline_t *deadline, uint64_t deadline_us, uint64_t need_us)
+{
+    uint64_t now;
+    uint64_t left;
+    
+    now = deadline->timestamp_us();                                      /* get time */
+    if ((now >= deadline_us) || ((deadline_us - now) < need_us))         /* not enough time */
+    {
+        return 0;                                                        /* no time */
+    }
+    left = deadline_us - now;                                            /* time left */
+    
+    return (left > 0xFFFFFFFFULL) ? 0xFFFFFFFFU : (uint32_t)left;        /* clamp */
+}
+
+/**
+ * @brief      run one bus read within the deadline
+ * @param[in]  *deadline pointer to a max30205 deadline structure
+ * @param[in]  deadline_us absolute deadline
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 4 deadline can not be met
+ * @note       none
+ */
+static uint8_t a_max30205_deadline_read(max30205_deadline_t *deadline, uint64_t deadline_us,
+                                        uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint64_t start;
+    uint64_t now;
+    uint32_t left;
+    uint32_t cost;
+    uint8_t res;
+    
+    left = a_max30205_deadline_remaining(deadline, deadline_us, deadline->read_us);             /* check the time */
+    if (left == 0)                                                                              /* no time */
+    {
+        return 4;                                                                               /* return error */
+    }
+    start = deadline->timestamp_us();                                                           /* start time */
+    res = deadline->iic_read(deadline->ctx, deadline->handle->iic_addr, reg, buf, len, left);   /* read */
+    now = deadline->timestamp_us();                                                             /* end time */
+    cost = (uint32_t)(now - start);                                                             /* read time */
+    if ((res == 0) && (cost > deadline->read_us))                                               /* longest good read */
+    {
+        deadline->read_us = cost;                                                               /* save it */
+    }
+    if ((now > deadline_us) || ((res != 0) && (now >= deadline_us)))                            /* too late or timed out */
+    {
+        return 4;                                                                               /* return error */
+    }
+    
+    return (res != 0) ? 1 : 0;                                                                  /* return the result */
+}
+
+/**
+ * @brief     init the deadline reader
+ * @param[in] *deadline pointer to a max30205 deadline structure
+ * @param[in] *handle pointer to an initialized max30205 handle
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ * @note      the handle is only used for its address, configuration and delay_ms
+ */
+uint8_t max30205_deadline_init(max30205_deadline_t *deadline, max30205_handle_t *handle)
+{
+    if ((deadline == NULL) || (handle == NULL))        /* check handle */
+    {
+        return 2;                                      /* return error */
+    }
+    if ((deadline->timestamp_us == NULL) || (deadline->iic_read == NULL) ||
+        (deadline->iic_write == NULL))                 /* check linked functions */
+    {
+        return 3;                                      /* return error */
+    }
+    
+    deadline->handle = handle;                         /* set handle */
+    deadline->read_us = 0;                             /* nothing measured */
+    deadline->write_us = 0;                            /* nothing measured */
+    deadline->missed = 0;                              /* clear missed */
+    deadline->inited = 1;                              /* flag inited */
+    
+    return 0;                                          /* success return 0 */
+}
+
+/**
+ * @brief      read data in the continuous mode before a deadline
+ * @param[in]  *deadline pointer to a max30205 deadline structure
+ * @param[in]  deadline_us absolute deadline on the timestamp_us clock
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *s pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 continuous read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 deadline can not be met
+ * @note       it returns 4 without a bus access when the remaining time is shorter than the longest
+ *             measured read, the hook gets the remaining time and a result that comes after the
+ *             deadline is dropped with 4
+ */
+uint8_t max30205_deadline_continuous_read(max30205_deadline_t *deadline, uint64_t deadline_us, int16_t *raw, float *s)
+{
+    uint8_t buf[2];
+    uint8_t res;
+    
+    if ((deadline == NULL) || (raw == NULL) || (s == NULL))                             /* check handle */
+    {
+        return 2;                                                                       /* return error */
+    }
+    if ((deadline->inited != 1) || (deadline->handle->inited != 1))                     /* check initialization */
+    {
+        return 3;                                                                       /* return error */
+    }
+    
+    memset(buf, 0, sizeof(uint8_t) * 2);                                                /* clear the buffer */
+    res = a_max30205_deadline_read(deadline, deadline_us, MAX30205_REG_TEMP, buf, 2);   /* read two bytes */
+    if (res != 0)                                                                       /* check result */
+    {
+        if (res == 4)                                                                   /* deadline */
+        {
+            deadline->missed++;                                                         /* count missed */
+        }
+        else
+        {
+            MAX30205_DEBUG_PRINT(deadline->handle, "max30205: read failed.\n");         /* read failed */
+        }
+        
+        return res;                                                                     /* return error */
+    }
+    *raw = (int16_t)(((uint16_t)buf[0]) << 8 | buf[1]);                                 /* get raw data */
+    
+    return max30205_convert_to_data(deadline->handle, *raw, s);                         /* convert raw data to real data */
+}
+
+#if (MAX30205_CONFIG_SINGLE_READ == 1)
+/**
+ * @brief      read data once before a deadline
+ * @param[in]  *deadline pointer to a max30205 deadline structure
+ * @param[in]  deadline_us absolute deadline on the timestamp_us clock
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *s pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 deadline can not be met
+ * @note       no conversion is started unless the write, the 50 ms conversion and the read all fit,
+ *             and a write that ends too late for the conversion and the read returns 4
+ */
+uint8_t max30205_deadline_single_read(max30205_deadline_t *deadline, uint64_t deadline_us, int16_t *raw, float *s)
+{
+    max30205_handle_t *handle;
+    uint64_t start;
+    uint64_t now;
+    uint64_t need;
+    uint64_t limit;
+    uint32_t left;
+    uint32_t timeout;
+    uint32_t cost;
+    uint8_t buf[2];
+    uint8_t reg;
+    uint8_t res;
+    
+    if ((deadline == NULL) || (raw == NULL) || (s == NULL))                                   /* check handle */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if ((deadline->inited != 1) || (deadline->handle->inited != 1))                           /* check initialization */
+    {
+        return 3;                                                                             /* return error */
+    }
+    
+    handle = deadline->handle;                                                                /* get handle */
+    need = (uint64_t)deadline->write_us + CONVERSION_TIME_MS * 1000ULL + deadline->read_us;   /* whole read */
+    left = a_max30205_deadline_remaining(deadline, deadline_us, need);                        /* check the time */
+    if (left == 0)                                                                            /* it does not fit */
+    {
+        deadline->missed++;                                                                   /* count missed */
+        
+        return 4;                                                                             /* return error */
+    }
+    limit = deadline_us - CONVERSION_TIME_MS * 1000ULL - deadline->read_us;                   /* latest write end */
+    timeout = left - CONVERSION_TIME_MS * 1000U - deadline->read_us;                          /* write timeout */
+    if (timeout == 0)                                                                         /* no time is no timeout */
+    {
+        timeout = 1;                                                                          /* at least 1 us */
+    }
+    reg = handle->reg | (1 << 0);                                                             /* enter shutdown mode */
+    reg = reg | (1 << 7);                                                                     /* set single read bit */
+    start = deadline->timestamp_us();                                                         /* start time */
+    res = deadline->iic_write(deadline->ctx, handle->iic_addr, MAX30205_REG_CONF,
+                              &reg, 1, timeout);                                              /* write conf */
+    now = deadline->timestamp_us();                                                           /* end time */
+    cost = (uint32_t)(now - start);                                                           /* write time */
+    if ((res == 0) && (cost > deadline->write_us))                                            /* longest good write */
+    {
+        deadline->write_us = cost;                                                            /* save it */
+    }
+    if ((now > limit) || ((res != 0) && (now >= limit)))                                      /* too late or timed out */
+    {
+        deadline->missed++;                                                                   /* count missed */
+        
+        return 4;                                                                             /* return error */
+    }
+    if (res != 0)                                                                             /* check result */
+    {
+        MAX30205_DEBUG_PRINT(handle, "max30205: write failed.\n");                            /* write failed */
+        
+        return 1;                                                                             /* return error */
+    }
+    MAX30205_DELAY_MS(handle, CONVERSION_TIME_MS);                                            /* delay 50 ms */
+    memset(buf, 0, sizeof(uint8_t) * 2);                                                      /* clear the buffer */
+    res = a_max30205_deadline_read(deadline, deadline_us, MAX30205_REG_TEMP, buf, 2);         /* read two bytes */
+    if (res != 0)                                                                             /* check result */
+    {
+        if (res == 4)                                                                         /* deadline */
+        {
+            deadline->missed++;                                                               /* count missed */
+        }
+        else
+        {
+            MAX30205_DEBUG_PRINT(handle, "max30205: read failed.\n");                         /* read failed */
+        }
+        
+        return res;                                                                           /* return error */
+    }
+    *raw = (int16_t)(((uint16_t)buf[0]) << 8 | buf[1]);                                       /* get raw data */
+    
+    return max30205_convert_to_data(handle, *raw, s);                                         /* convert raw data to real data */
+}
+#endif
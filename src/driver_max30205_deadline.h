@@ -0,0 +1,192 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_deadline.h
+ * @brief     driver max30205 deadline header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MAX30205_DEADLINE_H
+#define DRIVER_MAX30205_DEADLINE_H
+
+#include "driver_max30205.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup max30205_deadline_driver
+ * @{
+ */
+
+/**
+ * @brief max30205 deadline structure definition
+ */
+typedef struct max30205_deadline_s
+{
+    max30205_handle_t *handle;                                                      /**< max30205 handle */
+    uint64_t (*timestamp_us)(void);                                                 /**< point to a timestamp_us function address */
+    uint8_t (*iic_read)(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf,
+                        uint16_t len, uint32_t timeout_us);                         /**< point to an iic_read function address */
+    uint8_t (*iic_write)(void *ctx, uint8_t addr, uint8_t reg, uint8_t *buf,
+                         uint16_t len, uint32_t timeout_us);                        /**< point to an iic_write function address */
+    void *ctx;                                                                      /**< bus context passed to the hooks */
+    uint32_t read_us;                                                               /**< longest measured read */
+    uint32_t write_us;                                                              /**< longest measured write */
+    uint32_t missed;                                                                /**< calls that missed the deadline */
+    uint8_t inited;                                                                 /**< inited flag */
+} max30205_deadline_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup max30205_deadline_link_driver max30205 deadline link driver function
+ * @brief    max30205 deadline link driver modules
+ * @ingroup  max30205_deadline_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize max30205_deadline_t structure
+ * @param[in] DEADLINE pointer to a max30205 deadline structure
+ * @param[in] STRUCTURE max30205_deadline_t
+ * @note      none
+ */
+#define DRIVER_MAX30205_DEADLINE_LINK_INIT(DEADLINE, STRUCTURE)         memset(DEADLINE, 0, sizeof(STRUCTURE))
+
+/**
+ * @brief     link timestamp_us function
+ * @param[in] DEADLINE pointer to a max30205 deadline structure
+ * @param[in] FUC pointer to a timestamp_us function address
+ * @note      it returns a free running microsecond counter
+ */
+#define DRIVER_MAX30205_DEADLINE_LINK_TIMESTAMP_US(DEADLINE, FUC)       (DEADLINE)->timestamp_us = FUC
+
+/**
+ * @brief     link iic_read function
+ * @param[in] DEADLINE pointer to a max30205 deadline structure
+ * @param[in] FUC pointer to an iic_read function address
+ * @note      the hook must give up after timeout_us and return non zero,
+ *            max30205_interface_iic_read_timeout is the platform hook, on stm32f407 it ignores
+ *            timeout_us and a late result is only dropped
+ */
+#define DRIVER_MAX30205_DEADLINE_LINK_IIC_READ(DEADLINE, FUC)           (DEADLINE)->iic_read = FUC
+
+/**
+ * @brief     link iic_write function
+ * @param[in] DEADLINE pointer to a max30205 deadline structure
+ * @param[in] FUC pointer to an iic_write function address
+ * @note      the hook must give up after timeout_us and return non zero,
+ *            max30205_interface_iic_write_timeout is the platform hook, on stm32f407 it ignores
+ *            timeout_us and a late result is only dropped
+ */
+#define DRIVER_MAX30205_DEADLINE_LINK_IIC_WRITE(DEADLINE, FUC)          (DEADLINE)->iic_write = FUC
+
+/**
+ * @brief     link the bus context
+ * @param[in] DEADLINE pointer to a max30205 deadline structure
+ * @param[in] CTX pointer to a bus context
+ * @note      none
+ */
+#define DRIVER_MAX30205_DEADLINE_LINK_CTX(DEADLINE, CTX)                (DEADLINE)->ctx = CTX
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup max30205_deadline_driver max30205 deadline driver function
+ * @brief    max30205 deadline driver modules
+ * @ingroup  max30205_driver
+ * @{
+ */
+
+/**
+ * @brief     init the deadline reader
+ * @param[in] *deadline pointer to a max30205 deadline structure
+ * @param[in] *handle pointer to an initialized max30205 handle
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ * @note      the handle is only used for its address, configuration and delay_ms
+ */
+uint8_t max30205_deadline_init(max30205_deadline_t *deadline, max30205_handle_t *handle);
+
+/**
+ * @brief      read data in the continuous mode before a deadline
+ * @param[in]  *deadline pointer to a max30205 deadline structure
+ * @param[in]  deadline_us absolute deadline on the timestamp_us clock
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *s pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 continuous read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 deadline can not be met
+ * @note       it returns 4 without a bus access when the remaining time is shorter than the longest
+ *             measured read, the hook gets the remaining time and a result that comes after the
+ *             deadline is dropped with 4
+ */
+uint8_t max30205_deadline_continuous_read(max30205_deadline_t *deadline, uint64_t deadline_us, int16_t *raw, float *s);
+
+#if (MAX30205_CONFIG_SINGLE_READ == 1)
+/**
+ * @brief      read data once before a deadline
+ * @param[in]  *deadline pointer to a max30205 deadline structure
+ * @param[in]  deadline_us absolute deadline on the timestamp_us clock
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *s pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 deadline can not be met
+ * @note       no conversion is started unless the write, the 50 ms conversion and the read all fit,
+ *             and a write that ends too late for the conversion and the read returns 4
+ */
+uint8_t max30205_deadline_single_read(max30205_deadline_t *deadline, uint64_t deadline_us, int16_t *raw, float *s);
+#endif
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,401 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_device.hpp
+ * @brief     driver max30205 device template header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MAX30205_DEVICE_HPP
+#define DRIVER_MAX30205_DEVICE_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+#include "driver_max30205.h"
+
+/**
+ * @defgroup max30205_device_driver max30205 device template driver function
+ * @brief    max30205 device template driver modules
+ * @ingroup  max30205_driver
+ * @{
+ */
+
+namespace max30205
+{
+
+/**
+ * @brief max30205 bus policy concept
+ * @note  a bus policy is a type with static functions that mirror the handle hooks, so every
+ *        bus call is a direct call the compiler can inline instead of a function pointer
+ */
+template <typename B>
+concept bus_policy = requires(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, uint32_t ms)
+{
+    { B::init() } -> std::convertible_to<uint8_t>;
+    { B::deinit() } -> std::convertible_to<uint8_t>;
+    { B::read(addr, reg, buf, len) } -> std::convertible_to<uint8_t>;
+    { B::write(addr, reg, buf, len) } -> std::convertible_to<uint8_t>;
+    { B::delay_ms(ms) };
+};
+
+/**
+ * @brief max30205 device template
+ * @note  the constructor inits the bus and the destructor powers the chip down and deinits the
+ *        bus, a constructed device is always initialized so no call re-checks a handle
+ */
+template <bus_policy Bus, max30205_data_format_t Format = MAX30205_DATA_FORMAT_NORMAL>
+class device
+{
+    public:
+        static constexpr uint8_t REG_TEMP = 0x00;
+        static constexpr uint8_t REG_CONF = 0x01;
+        static constexpr uint8_t REG_THYST = 0x02;
+        static constexpr uint8_t REG_TOS = 0x03;
+        
+        /**
+         * @brief     init the bus
+         * @param[in] addr iic address pin
+         * @note      check ok() before use
+         */
+        explicit device(max30205_address_t addr) noexcept
+            : m_addr(static_cast<uint8_t>(addr)),
+              m_reg(Format == MAX30205_DATA_FORMAT_EXTENDED ? (1 << 5) : 0),
+              m_ok(Bus::init() == 0)
+        {
+        }
+        
+        /**
+         * @brief power down the chip and deinit the bus
+         * @note  none
+         */
+        ~device()
+        {
+            if (m_ok)
+            {
+                uint8_t reg = m_reg | 0x01;
+                
+                (void)Bus::write(m_addr, REG_CONF, &reg, 1);
+                (void)Bus::deinit();
+            }
+        }
+        
+        device(const device &) = delete;
+        device &operator=(const device &) = delete;
+        
+        /**
+         * @brief  check the bus init result
+         * @return true if the device can be used
+         * @note   none
+         */
+        bool ok() const noexcept
+        {
+            return m_ok;
+        }
+        
+        /**
+         * @brief     convert a raw value to degrees celsius
+         * @param[in] raw raw register value
+         * @return    converted temperature
+         * @note      the format branch is folded at compile time
+         */
+        static constexpr float convert_to_data(int16_t raw) noexcept
+        {
+            if constexpr (Format == MAX30205_DATA_FORMAT_EXTENDED)
+            {
+                return static_cast<float>(raw) * 0.00390625f + 64.0f;
+            }
+            else
+            {
+                return static_cast<float>(raw) * 0.00390625f;
+            }
+        }
+        
+        /**
+         * @brief     convert degrees celsius to a raw value
+         * @param[in] s temperature
+         * @return    raw register value
+         * @note      the format branch is folded at compile time
+         */
+        static constexpr int16_t convert_to_register(float s) noexcept
+        {
+            if constexpr (Format == MAX30205_DATA_FORMAT_EXTENDED)
+            {
+                return static_cast<int16_t>((s - 64.0f) / 0.00390625f);
+            }
+            else
+            {
+                return static_cast<int16_t>(s / 0.00390625f);
+            }
+        }
+        
+        /**
+         * @brief     set the interrupt mode
+         * @param[in] mode interrupt mode
+         * @note      committed by start_continuous_read
+         */
+        void set_interrupt_mode(max30205_interrupt_mode_t mode) noexcept
+        {
+            m_reg = static_cast<uint8_t>((m_reg & ~(1 << 1)) | (mode << 1));
+        }
+        
+        /**
+         * @brief     set the fault queue
+         * @param[in] fault_queue fault queue
+         * @note      committed by start_continuous_read
+         */
+        void set_fault_queue(max30205_fault_queue_t fault_queue) noexcept
+        {
+            m_reg = static_cast<uint8_t>((m_reg & ~(3 << 3)) | (fault_queue << 3));
+        }
+        
+        /**
+         * @brief     set the pin polarity
+         * @param[in] polarity pin polarity
+         * @note      committed by start_continuous_read
+         */
+        void set_pin_polarity(max30205_pin_polarity_t polarity) noexcept
+        {
+            m_reg = static_cast<uint8_t>((m_reg & ~(1 << 2)) | (polarity << 2));
+        }
+        
+        /**
+         * @brief     set the bus timeout
+         * @param[in] bus_timeout bus timeout
+         * @note      committed by start_continuous_read
+         */
+        void set_bus_timeout(max30205_bus_timeout_t bus_timeout) noexcept
+        {
+            m_reg = static_cast<uint8_t>((m_reg & ~(1 << 6)) | (bus_timeout << 6));
+        }
+        
+        /**
+         * @brief  start the chip reading
+         * @return status code
+         *         - 0 success
+         *         - 1 start continuous read failed
+         * @note   it commits the configuration set above
+         */
+        uint8_t start_continuous_read() noexcept
+        {
+            uint8_t reg = m_reg & static_cast<uint8_t>(~((1 << 0) | (1 << 7)));
+            
+            return Bus::write(m_addr, REG_CONF, &reg, 1) != 0 ? 1 : 0;
+        }
+        
+        /**
+         * @brief  stop the chip reading
+         * @return status code
+         *         - 0 success
+         *         - 1 stop continuous read failed
+         * @note   none
+         */
+        uint8_t stop_continuous_read() noexcept
+        {
+            uint8_t reg = m_reg | (1 << 0) | (1 << 7);
+            
+            return Bus::write(m_addr, REG_CONF, &reg, 1) != 0 ? 1 : 0;
+        }
+        
+        /**
+         * @brief      read data continuously
+         * @param[out] raw raw data
+         * @param[out] s converted temperature
+         * @return     status code
+         *             - 0 success
+         *             - 1 continuous read failed
+         * @note       none
+         */
+        uint8_t continuous_read(int16_t &raw, float &s) noexcept
+        {
+            if (a_read(REG_TEMP, raw) != 0)
+            {
+                return 1;
+            }
+            s = convert_to_data(raw);
+            
+            return 0;
+        }
+        
+        /**
+         * @brief      read data once
+         * @param[out] raw raw data
+         * @param[out] s converted temperature
+         * @return     status code
+         *             - 0 success
+         *             - 1 single read failed
+         * @note       none
+         */
+        uint8_t single_read(int16_t &raw, float &s) noexcept
+        {
+            if (stop_continuous_read() != 0)
+            {
+                return 1;
+            }
+            Bus::delay_ms(50);
+            
+            return continuous_read(raw, s);
+        }
+        
+        /**
+         * @brief      read a batch of samples continuously
+         * @param[out] raw raw data, one entry per sample
+         * @param[out] s converted temperatures, empty or the same size as raw
+         * @return     status code
+         *             - 0 success
+         *             - 1 continuous read failed
+         *             - 4 span size is invalid
+         * @note       the samples are read back to back on the bus
+         */
+        uint8_t continuous_read(std::span<int16_t> raw, std::span<float> s = {}) noexcept
+        {
+            if (!s.empty() && (s.size() != raw.size()))
+            {
+                return 4;
+            }
+            for (std::size_t i = 0; i < raw.size(); i++)
+            {
+                if (a_read(REG_TEMP, raw[i]) != 0)
+                {
+                    return 1;
+                }
+            }
+            for (std::size_t i = 0; i < s.size(); i++)
+            {
+                s[i] = convert_to_data(raw[i]);
+            }
+            
+            return 0;
+        }
+        
+        /**
+         * @brief     set the interrupt low threshold
+         * @param[in] threshold raw low threshold
+         * @return    status code
+         *            - 0 success
+         *            - 1 set interrupt low threshold failed
+         * @note      none
+         */
+        uint8_t set_interrupt_low_threshold(int16_t threshold) noexcept
+        {
+            return a_write(REG_THYST, threshold);
+        }
+        
+        /**
+         * @brief      get the interrupt low threshold
+         * @param[out] threshold raw low threshold
+         * @return     status code
+         *             - 0 success
+         *             - 1 get interrupt low threshold failed
+         * @note       none
+         */
+        uint8_t get_interrupt_low_threshold(int16_t &threshold) noexcept
+        {
+            return a_read(REG_THYST, threshold);
+        }
+        
+        /**
+         * @brief     set the interrupt high threshold
+         * @param[in] threshold raw high threshold
+         * @return    status code
+         *            - 0 success
+         *            - 1 set interrupt high threshold failed
+         * @note      none
+         */
+        uint8_t set_interrupt_high_threshold(int16_t threshold) noexcept
+        {
+            return a_write(REG_TOS, threshold);
+        }
+        
+        /**
+         * @brief      get the interrupt high threshold
+         * @param[out] threshold raw high threshold
+         * @return     status code
+         *             - 0 success
+         *             - 1 get interrupt high threshold failed
+         * @note       none
+         */
+        uint8_t get_interrupt_high_threshold(int16_t &threshold) noexcept
+        {
+            return a_read(REG_TOS, threshold);
+        }
+        
+        /**
+         * @brief  power down the chip
+         * @return status code
+         *         - 0 success
+         *         - 1 power down failed
+         * @note   none
+         */
+        uint8_t power_down() noexcept
+        {
+            uint8_t reg = m_reg | 0x01;
+            
+            return Bus::write(m_addr, REG_CONF, &reg, 1) != 0 ? 1 : 0;
+        }
+        
+    private:
+        uint8_t a_read(uint8_t reg, int16_t &value) noexcept
+        {
+            uint8_t buf[2];
+            
+            if (Bus::read(m_addr, reg, buf, 2) != 0)
+            {
+                return 1;
+            }
+            value = static_cast<int16_t>(static_cast<uint16_t>(buf[0]) << 8 | buf[1]);
+            
+            return 0;
+        }
+        
+        uint8_t a_write(uint8_t reg, int16_t value) noexcept
+        {
+            uint8_t buf[2];
+            
+            buf[0] = static_cast<uint8_t>((value >> 8) & 0xFF);
+            buf[1] = static_cast<uint8_t>(value & 0xFF);
+            
+            return Bus::write(m_addr, reg, buf, 2) != 0 ? 1 : 0;
+        }
+        
+        uint8_t m_addr;
+        uint8_t m_reg;
+        bool m_ok;
+};
+
+}
+
+/**
+ * @}
+ */
+
+#endif
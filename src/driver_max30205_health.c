@@ -0,0 +1,361 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_health.c
+ * @brief     driver max30205 health source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_max30205_health.h"
+
+/**
+ * @brief chip register definition
+ */
+#define MAX30205_REG_TEMP          0x00        /**< temperature register */
+
+/**
+ * @brief     open the circuit of a sensor
+ * @param[in] *health pointer to a max30205 health structure
+ * @param[in] *sensor pointer to a max30205 health sensor structure
+ * @param[in] timestamp_ms current time
+ * @param[in] backoff_ms probe interval
+ * @note      none
+ */
+static void a_max30205_health_open(max30205_health_t *health, max30205_health_sensor_t *sensor,
+                                   uint32_t timestamp_ms, uint32_t backoff_ms)
+{
+    if (backoff_ms > health->backoff_max_ms)             /* check the limit */
+    {
+        backoff_ms = health->backoff_max_ms;             /* clamp */
+    }
+    sensor->state = MAX30205_HEALTH_STATE_FAILED;        /* open the circuit */
+    sensor->backoff_ms = backoff_ms;                     /* set interval */
+    sensor->next_ms = timestamp_ms + backoff_ms;         /* schedule the probe */
+    sensor->due = 0;                                     /* wait for it */
+    sensor->good = 0;                                    /* clear good reads */
+}
+
+/**
+ * @brief     probe a failed sensor
+ * @param[in] *sensor pointer to a max30205 health sensor structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 probe failed
+ * @note      a silent read checks the presence first, so a missing sensor costs one short read and
+ *            prints nothing, then the configuration mirrored in the handle and both thresholds are
+ *            attached again, so a replugged sensor gets them back and a sensor that kept them is only read
+ */
+static uint8_t a_max30205_health_probe(max30205_health_sensor_t *sensor)
+{
+    max30205_attach_report_t report;
+    uint8_t buf[2];
+    
+    if (MAX30205_IIC_READ(sensor->handle, MAX30205_REG_TEMP, (uint8_t *)buf, 2) != 0)   /* silent presence check */
+    {
+        return 1;                                                                       /* return error */
+    }
+    if (max30205_attach(sensor->handle, 0, sensor->low_threshold,
+                        sensor->high_threshold, &report) != 0)                          /* attach and verify */
+    {
+        return 1;                                                                       /* return error */
+    }
+    
+    return 0;                                                                           /* success return 0 */
+}
+
+/**
+ * @brief     read a sensor whose circuit is closed
+ * @param[in] *health pointer to a max30205 health structure
+ * @param[in] *sensor pointer to a max30205 health sensor structure
+ * @param[in] timestamp_ms current time
+ * @note      none
+ */
+static void a_max30205_health_read(max30205_health_t *health, max30205_health_sensor_t *sensor,
+                                   uint32_t timestamp_ms)
+{
+    max30205_handle_t *handle = sensor->handle;
+    uint8_t buf[2];
+    
+    memset(buf, 0, sizeof(uint8_t) * 2);                                             /* clear the buffer */
+    if (MAX30205_IIC_READ(handle, MAX30205_REG_TEMP, (uint8_t *)buf, 2) != 0)        /* read two bytes */
+    {
+        sensor->res = 1;                                                             /* read failed */
+        sensor->good = 0;                                                            /* clear good reads */
+        if (sensor->errors < 0xFF)                                                   /* check the counter */
+        {
+            sensor->errors++;                                                        /* count error */
+        }
+        if (sensor->errors >= health->fail_errors)                                   /* too many errors */
+        {
+            sensor->trips++;                                                         /* count trip */
+            a_max30205_health_open(health, sensor, timestamp_ms,
+                                   health->backoff_min_ms);                          /* open the circuit */
+            MAX30205_DEBUG_PRINT(handle, "max30205: sensor failed.\n");              /* print once per trip */
+        }
+        else
+        {
+            sensor->state = MAX30205_HEALTH_STATE_DEGRADED;                          /* degraded */
+        }
+        
+        return;                                                                      /* return */
+    }
+    sensor->raw = (int16_t)(((uint16_t)buf[0]) << 8 | buf[1]);                       /* get raw data */
+    sensor->res = max30205_convert_to_data(handle, sensor->raw, &sensor->s);         /* convert raw data to real data */
+    sensor->errors = 0;                                                              /* clear errors */
+    if (sensor->state == MAX30205_HEALTH_STATE_DEGRADED)                             /* on probation */
+    {
+        sensor->good++;                                                              /* count good read */
+        if (sensor->good >= MAX30205_HEALTH_RECOVER_READS)                           /* enough good reads */
+        {
+            sensor->state = MAX30205_HEALTH_STATE_HEALTHY;                           /* healthy */
+            sensor->good = 0;                                                        /* clear good reads */
+        }
+    }
+}
+
+/**
+ * @brief     init the health monitor
+ * @param[in] *health pointer to a max30205 health structure
+ * @param[in] fail_errors errors in a row that open the circuit
+ * @param[in] backoff_min_ms first probe interval
+ * @param[in] backoff_max_ms longest probe interval
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 param is invalid
+ * @note      the probe interval doubles after every failed probe up to backoff_max_ms
+ */
+uint8_t max30205_health_init(max30205_health_t *health, uint8_t fail_errors,
+                             uint32_t backoff_min_ms, uint32_t backoff_max_ms)
+{
+    if (health == NULL)                                                             /* check handle */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if ((fail_errors == 0) || (backoff_min_ms == 0) ||
+        (backoff_max_ms < backoff_min_ms) || (backoff_max_ms > 0x7FFFFFFFU))        /* check param */
+    {
+        return 4;                                                                   /* return error */
+    }
+    
+    memset(health, 0, sizeof(max30205_health_t));                                   /* clear the monitor */
+    health->fail_errors = fail_errors;                                              /* set errors */
+    health->backoff_min_ms = backoff_min_ms;                                        /* set first interval */
+    health->backoff_max_ms = backoff_max_ms;                                        /* set longest interval */
+    health->inited = 1;                                                             /* flag inited */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      add a sensor
+ * @param[in]  *health pointer to a max30205 health structure
+ * @param[in]  *handle pointer to an initialized max30205 handle
+ * @param[in]  low_threshold hysteresis register written back by a probe
+ * @param[in]  high_threshold overtemperature register written back by a probe
+ * @param[out] *index pointer to a sensor index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 health monitor is not inited or handle is not initialized
+ *             - 5 sensors are full
+ * @note       the sensor starts failed and is probed by the first sweep,
+ *             so a sensor that is not plugged in yet is picked up when it appears
+ */
+uint8_t max30205_health_add(max30205_health_t *health, max30205_handle_t *handle,
+                            int16_t low_threshold, int16_t high_threshold, uint8_t *index)
+{
+    max30205_health_sensor_t *sensor;
+    
+    if ((health == NULL) || (handle == NULL) || (index == NULL))        /* check handle */
+    {
+        return 2;                                                       /* return error */
+    }
+    if ((health->inited != 1) || (handle->inited != 1))                 /* check initialization */
+    {
+        return 3;                                                       /* return error */
+    }
+    if (health->num >= MAX30205_CONFIG_GROUP_MAX)                       /* check the number */
+    {
+        return 5;                                                       /* return error */
+    }
+    
+    sensor = &health->sensor[health->num];                              /* get sensor */
+    memset(sensor, 0, sizeof(max30205_health_sensor_t));                /* clear the sensor */
+    sensor->handle = handle;                                            /* set handle */
+    sensor->low_threshold = low_threshold;                              /* set low threshold */
+    sensor->high_threshold = high_threshold;                            /* set high threshold */
+    sensor->state = MAX30205_HEALTH_STATE_FAILED;                       /* probe first */
+    sensor->backoff_ms = health->backoff_min_ms;                        /* set interval */
+    sensor->res = 4;                                                    /* no sample yet */
+    sensor->due = 1;                                                    /* probe at once */
+    *index = health->num;                                               /* set index */
+    health->num++;                                                      /* add one */
+    
+    return 0;                                                           /* success return 0 */
+}
+
+/**
+ * @brief     read every sensor whose circuit is closed and probe the due failed ones
+ * @param[in] *health pointer to a max30205 health structure
+ * @param[in] timestamp_ms current time
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 health monitor is not inited
+ * @note      the sensors must run continuous conversions, a probe attaches the configuration mirrored
+ *            in the handle and both thresholds, a sensor that answers is degraded until it reads
+ *            MAX30205_HEALTH_RECOVER_READS times in a row, only a trip prints and a probe of a missing
+ *            sensor is a silent read
+ */
+uint8_t max30205_health_sweep(max30205_health_t *health, uint32_t timestamp_ms)
+{
+    max30205_health_sensor_t *sensor;
+    uint8_t i;
+    
+    if (health == NULL)                                                              /* check handle */
+    {
+        return 2;                                                                    /* return error */
+    }
+    if (health->inited != 1)                                                         /* check initialization */
+    {
+        return 3;                                                                    /* return error */
+    }
+    
+    for (i = 0; i < health->num; i++)                                                /* every sensor */
+    {
+        sensor = &health->sensor[i];                                                 /* get sensor */
+        if (sensor->state != MAX30205_HEALTH_STATE_FAILED)                           /* circuit closed */
+        {
+            a_max30205_health_read(health, sensor, timestamp_ms);                    /* read it */
+            
+            continue;                                                                /* next */
+        }
+        sensor->res = 4;                                                             /* no sample */
+        if ((sensor->due == 0) && ((int32_t)(timestamp_ms - sensor->next_ms) < 0))   /* probe not due */
+        {
+            sensor->skipped++;                                                       /* count skip */
+            
+            continue;                                                                /* next */
+        }
+        if (a_max30205_health_probe(sensor) != 0)                                    /* probe */
+        {
+            sensor->probes++;                                                        /* count failed probe */
+            a_max30205_health_open(health, sensor, timestamp_ms,
+                                   (sensor->due != 0) ? health->backoff_min_ms :
+                                   sensor->backoff_ms * 2);                          /* back off */
+            
+            continue;                                                                /* next */
+        }
+        sensor->state = MAX30205_HEALTH_STATE_DEGRADED;                              /* close on probation */
+        sensor->errors = 0;                                                          /* clear errors */
+        sensor->good = 0;                                                            /* clear good reads */
+        sensor->backoff_ms = health->backoff_min_ms;                                 /* reset interval */
+    }
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief      get the sample of the last sweep
+ * @param[in]  *health pointer to a max30205 health structure
+ * @param[in]  index sensor index
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *s pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 health monitor is not inited
+ *             - 4 index is invalid or the sensor was skipped or probed
+ * @note       none
+ */
+uint8_t max30205_health_get_sample(max30205_health_t *health, uint8_t index, int16_t *raw, float *s)
+{
+    if ((health == NULL) || (raw == NULL) || (s == NULL))        /* check handle */
+    {
+        return 2;                                                /* return error */
+    }
+    if (health->inited != 1)                                     /* check initialization */
+    {
+        return 3;                                                /* return error */
+    }
+    if (index >= health->num)                                    /* check index */
+    {
+        return 4;                                                /* return error */
+    }
+    if (health->sensor[index].res != 0)                          /* no sample */
+    {
+        return health->sensor[index].res;                        /* return the sweep result */
+    }
+    
+    *raw = health->sensor[index].raw;                            /* get raw data */
+    *s = health->sensor[index].s;                                /* get converted data */
+    
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief      get the health of a sensor
+ * @param[in]  *health pointer to a max30205 health structure
+ * @param[in]  index sensor index
+ * @param[out] *state pointer to a health state buffer
+ * @param[out] *trips pointer to a circuit trips buffer
+ * @param[out] *backoff_ms pointer to a current probe interval buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 health monitor is not inited
+ *             - 4 index is invalid
+ * @note       none
+ */
+uint8_t max30205_health_get_state(max30205_health_t *health, uint8_t index, max30205_health_state_t *state,
+                                  uint32_t *trips, uint32_t *backoff_ms)
+{
+    if ((health == NULL) || (state == NULL) || (trips == NULL) || (backoff_ms == NULL))   /* check handle */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (health->inited != 1)                                                              /* check initialization */
+    {
+        return 3;                                                                         /* return error */
+    }
+    if (index >= health->num)                                                             /* check index */
+    {
+        return 4;                                                                         /* return error */
+    }
+    
+    *state = health->sensor[index].state;                                                 /* get state */
+    *trips = health->sensor[index].trips;                                                 /* get trips */
+    *backoff_ms = health->sensor[index].backoff_ms;                                       /* get interval */
+    
+    return 0;                                                                             /* success return 0 */
+}
@@ -0,0 +1,203 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_health.h
+ * @brief     driver max30205 health header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MAX30205_HEALTH_H
+#define DRIVER_MAX30205_HEALTH_H
+
+#include "driver_max30205_attach.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup max30205_health_driver
+ * @{
+ */
+
+/**
+ * @brief max30205 health recovery definition
+ */
+#ifndef MAX30205_HEALTH_RECOVER_READS
+    #define MAX30205_HEALTH_RECOVER_READS 3        /**< good reads in a row that make a degraded sensor healthy */
+#endif
+
+/**
+ * @brief max30205 health state enumeration definition
+ */
+typedef enum
+{
+    MAX30205_HEALTH_STATE_HEALTHY  = 0x00,        /**< reads succeed */
+    MAX30205_HEALTH_STATE_DEGRADED = 0x01,        /**< recent errors or on probation after a probe */
+    MAX30205_HEALTH_STATE_FAILED   = 0x02,        /**< circuit open, skipped until the next probe */
+} max30205_health_state_t;
+
+/**
+ * @brief max30205 health sensor structure definition
+ */
+typedef struct max30205_health_sensor_s
+{
+    max30205_handle_t *handle;            /**< max30205 handle */
+    int16_t low_threshold;                /**< hysteresis register restored by a probe */
+    int16_t high_threshold;               /**< overtemperature register restored by a probe */
+    max30205_health_state_t state;        /**< health state */
+    uint8_t errors;                       /**< errors in a row */
+    uint8_t good;                         /**< good reads in a row while degraded */
+    uint32_t backoff_ms;                  /**< current probe interval */
+    uint32_t next_ms;                     /**< time of the next probe */
+    uint8_t due;                          /**< probe at the next sweep */
+    uint32_t trips;                       /**< times the circuit opened */
+    uint32_t probes;                      /**< failed probes */
+    uint32_t skipped;                     /**< sweeps that skipped the sensor */
+    int16_t raw;                          /**< last raw data */
+    float s;                              /**< last converted data */
+    uint8_t res;                          /**< result of the last sweep */
+} max30205_health_sensor_t;
+
+/**
+ * @brief max30205 health structure definition
+ */
+typedef struct max30205_health_s
+{
+    max30205_health_sensor_t sensor[MAX30205_CONFIG_GROUP_MAX];        /**< sensors */
+    uint8_t num;                                                       /**< sensor number */
+    uint8_t fail_errors;                                               /**< errors in a row that open the circuit */
+    uint32_t backoff_min_ms;                                           /**< first probe interval */
+    uint32_t backoff_max_ms;                                           /**< longest probe interval */
+    uint8_t inited;                                                    /**< inited flag */
+} max30205_health_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup max30205_health_driver max30205 health driver function
+ * @brief    max30205 health driver modules
+ * @ingroup  max30205_driver
+ * @{
+ */
+
+/**
+ * @brief     init the health monitor
+ * @param[in] *health pointer to a max30205 health structure
+ * @param[in] fail_errors errors in a row that open the circuit
+ * @param[in] backoff_min_ms first probe interval
+ * @param[in] backoff_max_ms longest probe interval
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 param is invalid
+ * @note      the probe interval doubles after every failed probe up to backoff_max_ms
+ */
+uint8_t max30205_health_init(max30205_health_t *health, uint8_t fail_errors,
+                             uint32_t backoff_min_ms, uint32_t backoff_max_ms);
+
+/**
+ * @brief      add a sensor
+ * @param[in]  *health pointer to a max30205 health structure
+ * @param[in]  *handle pointer to an initialized max30205 handle
+ * @param[in]  low_threshold hysteresis register written back by a probe
+ * @param[in]  high_threshold overtemperature register written back by a probe
+ * @param[out] *index pointer to a sensor index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 health monitor is not inited or handle is not initialized
+ *             - 5 sensors are full
+ * @note       the sensor starts failed and is probed by the first sweep,
+ *             so a sensor that is not plugged in yet is picked up when it appears
+ */
+uint8_t max30205_health_add(max30205_health_t *health, max30205_handle_t *handle,
+                            int16_t low_threshold, int16_t high_threshold, uint8_t *index);
+
+/**
+ * @brief     read every sensor whose circuit is closed and probe the due failed ones
+ * @param[in] *health pointer to a max30205 health structure
+ * @param[in] timestamp_ms current time
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 health monitor is not inited
+ * @note      the sensors must run continuous conversions, a probe attaches the configuration mirrored
+ *            in the handle and both thresholds, a sensor that answers is degraded until it reads
+ *            MAX30205_HEALTH_RECOVER_READS times in a row, only a trip prints and a probe of a missing
+ *            sensor is a silent read
+ */
+uint8_t max30205_health_sweep(max30205_health_t *health, uint32_t timestamp_ms);
+
+/**
+ * @brief      get the sample of the last sweep
+ * @param[in]  *health pointer to a max30205 health structure
+ * @param[in]  index sensor index
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *s pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 health monitor is not inited
+ *             - 4 index is invalid or the sensor was skipped or probed
+ * @note       none
+ */
+uint8_t max30205_health_get_sample(max30205_health_t *health, uint8_t index, int16_t *raw, float *s);
+
+/**
+ * @brief      get the health of a sensor
+ * @param[in]  *health pointer to a max30205 health structure
+ * @param[in]  index sensor index
+ * @param[out] *state pointer to a health state buffer
+ * @param[out] *trips pointer to a circuit trips buffer
+ * @param[out] *backoff_ms pointer to a current probe interval buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 health monitor is not inited
+ *             - 4 index is invalid
+ * @note       none
+ */
+uint8_t max30205_health_get_state(max30205_health_t *health, uint8_t index, max30205_health_state_t *state,
+                                  uint32_t *trips, uint32_t *backoff_ms);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
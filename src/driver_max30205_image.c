@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_image.c
+ * @brief     driver max30205 image source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_max30205_image.h"
+
+/**
+ * @brief chip register definition
+ */
+#define MAX30205_REG_CONF         0x01        /**< configure register */
+#define MAX30205_REG_THYST        0x02        /**< thyst register */
+#define MAX30205_REG_TOS          0x03        /**< tos register */
+
+/**
+ * @brief     write a register image and start reading
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] *image pointer to a max30205 image structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write image failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 image is invalid
+ * @note      it costs three register writes, thyst and tos are written before conf so the chip
+ *            never compares against stale thresholds, the handle configuration follows the image,
+ *            an image with the extended format is invalid when MAX30205_CONFIG_EXTENDED_FORMAT is 0
+ */
+uint8_t max30205_image_write(max30205_handle_t *handle, const max30205_image_t *image)
+{
+    uint8_t buf[2];
+    uint8_t conf;
+    
+    if ((handle == NULL) || (image == NULL))                                                /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+#if (MAX30205_CONFIG_EXTENDED_FORMAT == 0)
+    if ((image->conf & (1 << 5)) != 0)                                                      /* check the format */
+    {
+        MAX30205_DEBUG_PRINT(handle, "max30205: extended format is not built.\n");         /* extended format */
+        
+        return 4;                                                                           /* return error */
+    }
+#endif
+    
+    buf[0] = (image->thyst >> 8) & 0xFF;                                                    /* MSB */
+    buf[1] = image->thyst & 0xFF;                                                           /* LSB */
+    if (MAX30205_IIC_WRITE(handle, MAX30205_REG_THYST, (uint8_t *)buf, 2) != 0)             /* write thyst */
+    {
+        MAX30205_DEBUG_PRINT(handle, "max30205: write thyst failed.\n");                    /* write thyst failed */
+        
+        return 1;                                                                           /* return error */
+    }
+    buf[0] = (image->tos >> 8) & 0xFF;                                                      /* MSB */
+    buf[1] = image->tos & 0xFF;                                                             /* LSB */
+    if (MAX30205_IIC_WRITE(handle, MAX30205_REG_TOS, (uint8_t *)buf, 2) != 0)               /* write tos */
+    {
+        MAX30205_DEBUG_PRINT(handle, "max30205: write tos failed.\n");                      /* write tos failed */
+        
+        return 1;                                                                           /* return error */
+    }
+    conf = image->conf & (~((1 << 0) | (1 << 7)));                                          /* exit shutdown mode */
+    if (MAX30205_IIC_WRITE(handle, MAX30205_REG_CONF, (uint8_t *)&conf, 1) != 0)            /* write conf */
+    {
+        MAX30205_DEBUG_PRINT(handle, "max30205: write conf failed.\n");                     /* write conf failed */
+        
+        return 1;                                                                           /* return error */
+    }
+    handle->reg = conf;                                                                     /* save the configuration */
+    
+    return 0;                                                                               /* success return 0 */
+}
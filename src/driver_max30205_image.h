@@ -0,0 +1,162 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_image.h
+ * @brief     driver max30205 image header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MAX30205_IMAGE_H
+#define DRIVER_MAX30205_IMAGE_H
+
+#include "driver_max30205.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup max30205_image_driver
+ * @{
+ */
+
+/**
+ * @brief max30205 register image structure definition
+ */
+typedef struct max30205_image_s
+{
+    uint8_t conf;         /**< conf register */
+    int16_t thyst;        /**< thyst register */
+    int16_t tos;          /**< tos register */
+} max30205_image_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup max30205_image_driver max30205 image driver function
+ * @brief    max30205 image driver modules
+ * @ingroup  max30205_driver
+ * @{
+ */
+
+/**
+ * @brief     convert a temperature to an unclamped register count at build time
+ * @param[in] FORMAT max30205 data format
+ * @param[in] S temperature in degrees celsius
+ * @note      none
+ */
+#define MAX30205_IMAGE_COUNT(FORMAT, S)                                                     \
+    (((S) - (((FORMAT) == MAX30205_DATA_FORMAT_EXTENDED) ? 64.0 : 0.0)) / 0.00390625)
+
+/**
+ * @brief     convert a temperature to a register value at build time
+ * @param[in] FORMAT max30205 data format
+ * @param[in] S temperature in degrees celsius
+ * @note      it is a constant expression when both arguments are constants and truncates like
+ *            max30205_convert_to_register, a temperature outside the register range saturates
+ *            at -128C to 127.996C, or -64C to 191.996C in the extended format
+ */
+#define MAX30205_IMAGE_TEMP(FORMAT, S)                                                      \
+    ((int16_t)((MAX30205_IMAGE_COUNT(FORMAT, S) <= -32768.0) ? -32768 :                    \
+               (MAX30205_IMAGE_COUNT(FORMAT, S) >= 32767.0) ? 32767 :                      \
+               MAX30205_IMAGE_COUNT(FORMAT, S)))
+
+/**
+ * @brief     check the data format at build time
+ * @param[in] FORMAT max30205 data format
+ * @note      FORMAT must be a constant, the extended format is a build error when
+ *            MAX30205_CONFIG_EXTENDED_FORMAT is 0
+ */
+#if (MAX30205_CONFIG_EXTENDED_FORMAT == 1)
+    #define MAX30205_IMAGE_FORMAT(FORMAT)    (FORMAT)
+#else
+    #define MAX30205_IMAGE_FORMAT(FORMAT)                                                   \
+        ((FORMAT) + 0 * sizeof(char[((FORMAT) == MAX30205_DATA_FORMAT_EXTENDED) ? -1 : 1]))
+#endif
+
+/**
+ * @brief     build a conf register value at build time
+ * @param[in] FORMAT max30205 data format
+ * @param[in] MODE max30205 interrupt mode
+ * @param[in] QUEUE max30205 fault queue
+ * @param[in] POLARITY max30205 pin polarity
+ * @param[in] TIMEOUT max30205 bus timeout
+ * @note      the shutdown and one-shot bits are cleared
+ */
+#define MAX30205_IMAGE_CONF(FORMAT, MODE, QUEUE, POLARITY, TIMEOUT)                         \
+    ((uint8_t)(((TIMEOUT) << 6) | (MAX30205_IMAGE_FORMAT(FORMAT) << 5) | ((QUEUE) << 3) |   \
+               ((POLARITY) << 2) | ((MODE) << 1)))
+
+/**
+ * @brief     initialize a max30205_image_t structure at build time
+ * @param[in] FORMAT max30205 data format
+ * @param[in] MODE max30205 interrupt mode
+ * @param[in] QUEUE max30205 fault queue
+ * @param[in] POLARITY max30205 pin polarity
+ * @param[in] TIMEOUT max30205 bus timeout
+ * @param[in] LOW interrupt low threshold in degrees celsius
+ * @param[in] HIGH interrupt high threshold in degrees celsius
+ * @note      use it as the initializer of a static const max30205_image_t
+ */
+#define MAX30205_IMAGE_INIT(FORMAT, MODE, QUEUE, POLARITY, TIMEOUT, LOW, HIGH)              \
+    {                                                                                       \
+        MAX30205_IMAGE_CONF(FORMAT, MODE, QUEUE, POLARITY, TIMEOUT),                        \
+        MAX30205_IMAGE_TEMP(FORMAT, LOW),                                                   \
+        MAX30205_IMAGE_TEMP(FORMAT, HIGH),                                                  \
+    }
+
+/**
+ * @brief     write a register image and start reading
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] *image pointer to a max30205 image structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write image failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 image is invalid
+ * @note      it costs three register writes, thyst and tos are written before conf so the chip
+ *            never compares against stale thresholds, the handle configuration follows the image,
+ *            an image with the extended format is invalid when MAX30205_CONFIG_EXTENDED_FORMAT is 0
+ */
+uint8_t max30205_image_write(max30205_handle_t *handle, const max30205_image_t *image);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
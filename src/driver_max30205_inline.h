@@ -0,0 +1,201 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_inline.h
+ * @brief     driver max30205 inline header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MAX30205_INLINE_H
+#define DRIVER_MAX30205_INLINE_H
+
+#include "driver_max30205.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup max30205_inline_driver max30205 inline driver function
+ * @brief    max30205 inline driver modules
+ * @ingroup  max30205_driver
+ * @{
+ */
+
+/**
+ * @brief inline argument check definition
+ * @note  define it to 0 before including this file to drop the handle and initialization checks
+ *        from the inline hot path once the application is known to pass valid handles
+ */
+#ifndef MAX30205_INLINE_CHECK
+    #define MAX30205_INLINE_CHECK    1
+#endif
+
+/**
+ * @brief inline register definition
+ */
+#define MAX30205_INLINE_REG_TEMP    0x00        /**< temperature register */
+#define MAX30205_INLINE_REG_CONF    0x01        /**< configure register */
+
+/**
+ * @brief     convert a raw value to degrees celsius
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] raw raw data
+ * @return    converted temperature
+ * @note      none
+ */
+static inline float max30205_inline_convert_to_data(const max30205_handle_t *handle, int16_t raw)
+{
+    float s;
+    
+    s = (float)(raw) * 0.00390625f;           /* convert raw data to real data */
+#if (MAX30205_CONFIG_EXTENDED_FORMAT == 1)
+    if ((handle->reg & (1 << 5)) != 0)        /* extended format */
+    {
+        s += 64.0f;                           /* add the extended offset */
+    }
+#else
+    (void)handle;                             /* normal format only */
+#endif
+    
+    return s;                                 /* return the temperature */
+}
+
+/**
+ * @brief     convert degrees celsius to a raw value
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] s temperature
+ * @return    raw data
+ * @note      none
+ */
+static inline int16_t max30205_inline_convert_to_register(const max30205_handle_t *handle, float s)
+{
+#if (MAX30205_CONFIG_EXTENDED_FORMAT == 1)
+    if ((handle->reg & (1 << 5)) != 0)        /* extended format */
+    {
+        s -= 64.0f;                           /* remove the extended offset */
+    }
+#else
+    (void)handle;                             /* normal format only */
+#endif
+    
+    return (int16_t)(s / 0.00390625f);        /* convert real data to register data */
+}
+
+/**
+ * @brief      read data continuously
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *s pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 continuous read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       it behaves like max30205_continuous_read, the checks returning 2 and 3 are
+ *             compiled only when MAX30205_INLINE_CHECK is 1
+ */
+static inline uint8_t max30205_inline_continuous_read(max30205_handle_t *handle, int16_t *raw, float *s)
+{
+    uint8_t buf[2];
+    
+#if (MAX30205_INLINE_CHECK == 1)
+    if (handle == NULL)                                                                         /* check handle */
+    {
+        return 2;                                                                               /* return error */
+    }
+    if (handle->inited != 1)                                                                    /* check handle initialization */
+    {
+        return 3;                                                                               /* return error */
+    }
+#endif
+    
+    if (MAX30205_IIC_READ(handle, MAX30205_INLINE_REG_TEMP, (uint8_t *)buf, 2) != 0)            /* read two bytes */
+    {
+        MAX30205_DEBUG_PRINT(handle, "max30205: read failed.\n");                               /* read temp failed */
+        
+        return 1;                                                                               /* return error */
+    }
+    *raw = (int16_t)(((uint16_t)buf[0]) << 8 | buf[1]);                                         /* get raw data */
+    *s = max30205_inline_convert_to_data(handle, *raw);                                         /* convert raw data to real data */
+    
+    return 0;                                                                                   /* success return 0 */
+}
+
+/**
+ * @brief      read data once
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *s pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       it behaves like max30205_single_read, the checks returning 2 and 3 are
+ *             compiled only when MAX30205_INLINE_CHECK is 1
+ */
+static inline uint8_t max30205_inline_single_read(max30205_handle_t *handle, int16_t *raw, float *s)
+{
+    uint8_t reg;
+    
+#if (MAX30205_INLINE_CHECK == 1)
+    if (handle == NULL)                                                                           /* check handle */
+    {
+        return 2;                                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                                      /* check handle initialization */
+    {
+        return 3;                                                                                 /* return error */
+    }
+#endif
+    
+    reg = handle->reg | (1 << 0) | (1 << 7);                                                      /* shutdown and one-shot */
+    if (MAX30205_IIC_WRITE(handle, MAX30205_INLINE_REG_CONF, (uint8_t *)&reg, 1) != 0)            /* write conf */
+    {
+        MAX30205_DEBUG_PRINT(handle, "max30205: write failed.\n");                                /* write failed */
+        
+        return 1;                                                                                 /* return error */
+    }
+    MAX30205_DELAY_MS(handle, 50);                                                                /* delay 50 ms */
+    
+    return max30205_inline_continuous_read(handle, raw, s);                                       /* read the result */
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,273 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_oneshot.c
+ * @brief     driver max30205 oneshot source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_max30205_oneshot.h"
+
+#if (MAX30205_CONFIG_SINGLE_READ == 1)
+
+/**
+ * @brief chip register definition
+ */
+#define MAX30205_REG_TEMP        0x00        /**< temperature register */
+#define MAX30205_REG_CONF        0x01        /**< configuration register */
+
+/**
+ * @brief chip conversion definition
+ */
+#define CONVERSION_TIME_MS       50          /**< max conversion time */
+
+/**
+ * @brief     get the wait for the next conversion
+ * @param[in] *oneshot pointer to a max30205 oneshot structure
+ * @return    wait time, 0 means no trusted wait
+ * @note      none
+ */
+static uint16_t a_max30205_oneshot_wait(max30205_oneshot_t *oneshot)
+{
+    uint16_t wait;
+    
+    if ((oneshot->supported == 0) || (oneshot->samples < MAX30205_ONESHOT_CONFIDENCE))   /* low confidence */
+    {
+        return 0;                                                                        /* no trusted wait */
+    }
+    wait = oneshot->learned_ms + MAX30205_ONESHOT_GUARD_MS;                              /* learned time and guard */
+    
+    return (wait < CONVERSION_TIME_MS) ? wait : CONVERSION_TIME_MS;                      /* never above the datasheet */
+}
+
+/**
+ * @brief     init the calibrated one-shot reader
+ * @param[in] *oneshot pointer to a max30205 oneshot structure
+ * @param[in] *handle pointer to an initialized max30205 handle
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      it starts with no confidence and measures the first conversions
+ */
+uint8_t max30205_oneshot_init(max30205_oneshot_t *oneshot, max30205_handle_t *handle)
+{
+    if ((oneshot == NULL) || (handle == NULL))             /* check handle */
+    {
+        return 2;                                          /* return error */
+    }
+    
+    memset(oneshot, 0, sizeof(max30205_oneshot_t));        /* clear the reader */
+    oneshot->handle = handle;                              /* set handle */
+    oneshot->supported = 1;                                /* assume the bit clears */
+    
+    return 0;                                              /* success return 0 */
+}
+
+/**
+ * @brief      read data once with the calibrated wait
+ * @param[in]  *oneshot pointer to a max30205 oneshot structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *s pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the one-shot bit is read back before the temperature, so a value is only returned after
+ *             the conversion finished, without confidence it polls every millisecond and learns the
+ *             conversion time, and a chip that never clears the bit or clears it faster than a real
+ *             conversion gets the datasheet 50 ms wait
+ */
+uint8_t max30205_oneshot_read(max30205_oneshot_t *oneshot, int16_t *raw, float *s)
+{
+    max30205_handle_t *handle;
+    uint8_t buf[2];
+    uint8_t reg;
+    uint16_t wait;
+    uint16_t elapsed;
+    
+    if ((oneshot == NULL) || (oneshot->handle == NULL))                                  /* check handle */
+    {
+        return 2;                                                                        /* return error */
+    }
+    handle = oneshot->handle;                                                            /* get handle */
+    if (handle->inited != 1)                                                             /* check handle initialization */
+    {
+        return 3;                                                                        /* return error */
+    }
+    
+    reg = handle->reg | (1 << 0);                                                        /* enter shutdown mode */
+    reg = reg | (1 << 7);                                                                /* set single read bit */
+    if (MAX30205_IIC_WRITE(handle, MAX30205_REG_CONF, (uint8_t *)&reg, 1) != 0)          /* write conf */
+    {
+        MAX30205_DEBUG_PRINT(handle, "max30205: write failed.\n");                       /* write failed */
+        
+        return 1;                                                                        /* return error */
+    }
+    if (oneshot->supported == 0)                                                         /* bit never clears */
+    {
+        MAX30205_DELAY_MS(handle, CONVERSION_TIME_MS);                                   /* datasheet wait */
+        oneshot->fallback++;                                                             /* count fallback */
+    }
+    else
+    {
+        wait = a_max30205_oneshot_wait(oneshot);                                         /* get the wait */
+        if (wait != 0)                                                                   /* trusted wait */
+        {
+            MAX30205_DELAY_MS(handle, wait);                                             /* learned wait */
+        }
+        elapsed = wait;                                                                  /* waited time */
+        while (1)                                                                        /* until the conversion is done */
+        {
+            if (MAX30205_IIC_READ(handle, MAX30205_REG_CONF, (uint8_t *)&reg, 1) != 0)   /* read conf */
+            {
+                MAX30205_DEBUG_PRINT(handle, "max30205: read failed.\n");                /* read failed */
+                
+                return 1;                                                                /* return error */
+            }
+            if ((reg & (1 << 7)) == 0)                                                   /* conversion done */
+            {
+                break;                                                                   /* break */
+            }
+            if (elapsed >= CONVERSION_TIME_MS)                                           /* datasheet time passed */
+            {
+                oneshot->supported = 0;                                                  /* bit does not clear */
+                
+                break;                                                                   /* break */
+            }
+            MAX30205_DELAY_MS(handle, 1);                                                /* delay 1 ms */
+            elapsed++;                                                                   /* count time */
+        }
+        if ((oneshot->supported != 0) && (elapsed < MAX30205_ONESHOT_MIN_MS))            /* too fast for a conversion */
+        {
+            oneshot->supported = 0;                                                      /* the bit is not trusted */
+            MAX30205_DELAY_MS(handle, CONVERSION_TIME_MS - elapsed);                     /* finish the datasheet wait */
+        }
+        if (oneshot->supported == 0)                                                     /* no completion seen */
+        {
+            oneshot->fallback++;                                                         /* count fallback */
+        }
+        else if (wait == 0)                                                              /* measured conversion */
+        {
+            if (elapsed > oneshot->learned_ms)                                           /* longest one */
+            {
+                oneshot->learned_ms = elapsed;                                           /* save it */
+            }
+            if (oneshot->samples < 255)                                                  /* check the range */
+            {
+                oneshot->samples++;                                                      /* count samples */
+            }
+        }
+        else if (elapsed > wait)                                                         /* the learned wait was short */
+        {
+            oneshot->learned_ms = elapsed;                                               /* learn the longer time */
+            oneshot->samples = 0;                                                        /* measure again */
+            oneshot->missed++;                                                           /* count miss */
+        }
+        else
+        {
+            oneshot->fast++;                                                             /* count fast read */
+        }
+    }
+    memset(buf, 0, sizeof(uint8_t) * 2);                                                 /* clear the buffer */
+    if (MAX30205_IIC_READ(handle, MAX30205_REG_TEMP, (uint8_t *)buf, 2) != 0)            /* read two bytes */
+    {
+        MAX30205_DEBUG_PRINT(handle, "max30205: read failed.\n");                        /* read failed */
+        
+        return 1;                                                                        /* return error */
+    }
+    *raw = (int16_t)(((uint16_t)buf[0]) << 8 | buf[1]);                                  /* get raw data */
+    
+    return max30205_convert_to_data(handle, *raw, s);                                    /* convert raw data to real data */
+}
+
+/**
+ * @brief      run measured conversions until the wait is trusted
+ * @param[in]  *oneshot pointer to a max30205 oneshot structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 chip does not clear the one-shot bit
+ * @note       none
+ */
+uint8_t max30205_oneshot_calibrate(max30205_oneshot_t *oneshot)
+{
+    uint8_t res;
+    int16_t raw;
+    float s;
+    
+    if (oneshot == NULL)                                            /* check handle */
+    {
+        return 2;                                                   /* return error */
+    }
+    
+    while ((oneshot->supported != 0) &&
+           (oneshot->samples < MAX30205_ONESHOT_CONFIDENCE))        /* until confident */
+    {
+        res = max30205_oneshot_read(oneshot, &raw, &s);             /* measured read */
+        if (res != 0)                                               /* check result */
+        {
+            return res;                                             /* return error */
+        }
+    }
+    
+    return (oneshot->supported != 0) ? 0 : 4;                       /* return the result */
+}
+
+/**
+ * @brief      get the current wait
+ * @param[in]  *oneshot pointer to a max30205 oneshot structure
+ * @param[out] *wait_ms pointer to a wait time buffer
+ * @param[out] *confident pointer to a confidence buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       the wait is the datasheet 50 ms while confident is 0
+ */
+uint8_t max30205_oneshot_get_wait(max30205_oneshot_t *oneshot, uint16_t *wait_ms, uint8_t *confident)
+{
+    uint16_t wait;
+    
+    if ((oneshot == NULL) || (wait_ms == NULL) || (confident == NULL))        /* check handle */
+    {
+        return 2;                                                             /* return error */
+    }
+    
+    wait = a_max30205_oneshot_wait(oneshot);                                  /* get the wait */
+    *confident = (wait != 0) ? 1 : 0;                                         /* set confidence */
+    *wait_ms = (wait != 0) ? wait : CONVERSION_TIME_MS;                       /* set wait */
+    
+    return 0;                                                                 /* success return 0 */
+}
+
+#endif
@@ -0,0 +1,162 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_oneshot.h
+ * @brief     driver max30205 oneshot header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MAX30205_ONESHOT_H
+#define DRIVER_MAX30205_ONESHOT_H
+
+#include "driver_max30205.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#if (MAX30205_CONFIG_SINGLE_READ == 1)
+
+/**
+ * @addtogroup max30205_oneshot_driver
+ * @{
+ */
+
+/**
+ * @brief max30205 oneshot guard definition
+ */
+#ifndef MAX30205_ONESHOT_GUARD_MS
+    #define MAX30205_ONESHOT_GUARD_MS 2        /**< margin added to the learned conversion time */
+#endif
+
+/**
+ * @brief max30205 oneshot confidence definition
+ */
+#ifndef MAX30205_ONESHOT_CONFIDENCE
+    #define MAX30205_ONESHOT_CONFIDENCE 8        /**< measured conversions before the learned wait is used */
+#endif
+
+/**
+ * @brief max30205 oneshot plausible conversion definition
+ */
+#ifndef MAX30205_ONESHOT_MIN_MS
+    #define MAX30205_ONESHOT_MIN_MS 10        /**< shortest measured conversion that is trusted */
+#endif
+
+/**
+ * @brief max30205 oneshot structure definition
+ */
+typedef struct max30205_oneshot_s
+{
+    max30205_handle_t *handle;        /**< max30205 handle */
+    uint8_t supported;                /**< 1 while the chip clears the one-shot bit after a conversion */
+    uint8_t samples;                  /**< measured conversions since the last miss */
+    uint16_t learned_ms;              /**< longest measured conversion */
+    uint32_t fast;                    /**< reads that used the learned wait */
+    uint32_t missed;                  /**< learned waits that found the conversion still running */
+    uint32_t fallback;                /**< reads that used the datasheet wait */
+} max30205_oneshot_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup max30205_oneshot_driver max30205 oneshot driver function
+ * @brief    max30205 oneshot driver modules
+ * @ingroup  max30205_driver
+ * @{
+ */
+
+/**
+ * @brief     init the calibrated one-shot reader
+ * @param[in] *oneshot pointer to a max30205 oneshot structure
+ * @param[in] *handle pointer to an initialized max30205 handle
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      it starts with no confidence and measures the first conversions
+ */
+uint8_t max30205_oneshot_init(max30205_oneshot_t *oneshot, max30205_handle_t *handle);
+
+/**
+ * @brief      read data once with the calibrated wait
+ * @param[in]  *oneshot pointer to a max30205 oneshot structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *s pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the one-shot bit is read back before the temperature, so a value is only returned after
+ *             the conversion finished, without confidence it polls every millisecond and learns the
+ *             conversion time, and a chip that never clears the bit or clears it faster than a real
+ *             conversion gets the datasheet 50 ms wait
+ */
+uint8_t max30205_oneshot_read(max30205_oneshot_t *oneshot, int16_t *raw, float *s);
+
+/**
+ * @brief      run measured conversions until the wait is trusted
+ * @param[in]  *oneshot pointer to a max30205 oneshot structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 chip does not clear the one-shot bit
+ * @note       none
+ */
+uint8_t max30205_oneshot_calibrate(max30205_oneshot_t *oneshot);
+
+/**
+ * @brief      get the current wait
+ * @param[in]  *oneshot pointer to a max30205 oneshot structure
+ * @param[out] *wait_ms pointer to a wait time buffer
+ * @param[out] *confident pointer to a confidence buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       the wait is the datasheet 50 ms while confident is 0
+ */
+uint8_t max30205_oneshot_get_wait(max30205_oneshot_t *oneshot, uint16_t *wait_ms, uint8_t *confident);
+
+/**
+ * @}
+ */
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
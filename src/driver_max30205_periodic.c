@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_periodic.c
+ * @brief     driver max30205 periodic source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_max30205_periodic.h"
+
+/**
+ * @brief     init the periodic sampler
+ * @param[in] *periodic pointer to a max30205 periodic structure
+ * @param[in] *handle pointer to an initialized max30205 handle with a linked timestamp_us
+ * @param[in] *read pointer to a read function, max30205_continuous_read or max30205_single_read
+ * @param[in] period_us sampling period
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 period is invalid
+ * @note      none
+ */
+uint8_t max30205_periodic_init(max30205_periodic_t *periodic, max30205_handle_t *handle,
+                               uint8_t (*read)(max30205_handle_t *handle, int16_t *raw, float *s),
+                               uint32_t period_us)
+{
+    if ((periodic == NULL) || (handle == NULL) || (read == NULL))                             /* check handle */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if ((periodic->sleep_until_us == NULL) || (MAX30205_OPS(handle)->timestamp_us == NULL))   /* check linked functions */
+    {
+        return 3;                                                                             /* return error */
+    }
+    if (period_us == 0)                                                                       /* check the period */
+    {
+        return 4;                                                                             /* return error */
+    }
+    
+    periodic->handle = handle;                                                                /* set handle */
+    periodic->read = read;                                                                    /* set read */
+    periodic->period_us = period_us;                                                          /* set period */
+    periodic->next_us = 0;                                                                    /* no deadline */
+    periodic->jitter_sum_us = 0;                                                              /* clear sum */
+    memset(&periodic->stats, 0, sizeof(max30205_periodic_stats_t));                           /* clear statistics */
+    periodic->started = 0;                                                                    /* not started */
+    periodic->inited = 1;                                                                     /* flag inited */
+    
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief      wait for the next deadline and read
+ * @param[in]  *periodic pointer to a max30205 periodic structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *s pointer to a converted data buffer
+ * @param[out] *timestamp_us pointer to a timestamp buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 periodic sampler is not inited
+ * @note       deadlines are absolute, so the read time does not shift the period, the first call
+ *             reads at once, a call later than the deadline reads at once, and a call that missed a
+ *             whole period counts an overrun and drops the missed deadlines without changing the phase
+ */
+uint8_t max30205_periodic_read(max30205_periodic_t *periodic, int16_t *raw, float *s, uint64_t *timestamp_us)
+{
+    max30205_periodic_stats_t *stats;
+    uint64_t now;
+    uint64_t missed;
+    int32_t jitter;
+    uint8_t res;
+    
+    if ((periodic == NULL) || (timestamp_us == NULL))                                 /* check handle */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (periodic->inited != 1)                                                        /* check the sampler */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    stats = &periodic->stats;                                                          /* get statistics */
+    now = MAX30205_TIMESTAMP_US(periodic->handle);                                     /* get time */
+    if (periodic->started == 0)                                                        /* first read */
+    {
+        periodic->next_us = now;                                                       /* read at once */
+        periodic->started = 1;                                                         /* started */
+    }
+    else if (now >= periodic->next_us + periodic->period_us)                           /* a whole period missed */
+    {
+        missed = (now - periodic->next_us) / periodic->period_us + 1;                  /* missed deadlines */
+        periodic->next_us += missed * periodic->period_us;                             /* next one in phase */
+        stats->overruns++;                                                             /* count overrun */
+        stats->skipped += (uint32_t)missed;                                            /* count skipped */
+    }
+    periodic->sleep_until_us(periodic->next_us);                                       /* sleep until the deadline */
+    now = MAX30205_TIMESTAMP_US(periodic->handle);                                     /* wake up time */
+    jitter = (int32_t)((int64_t)(now - periodic->next_us));                            /* wake up delay */
+    if ((stats->samples == 0) || (jitter < stats->jitter_min_us))                      /* earliest */
+    {
+        stats->jitter_min_us = jitter;                                                 /* save min */
+    }
+    if ((stats->samples == 0) || (jitter > stats->jitter_max_us))                      /* latest */
+    {
+        stats->jitter_max_us = jitter;                                                 /* save max */
+    }
+    periodic->jitter_sum_us += jitter;                                                 /* add delay */
+    stats->samples++;                                                                  /* count samples */
+    stats->jitter_mean_us = (float)periodic->jitter_sum_us / (float)stats->samples;    /* mean delay */
+    
+    res = periodic->read(periodic->handle, raw, s);                                    /* read */
+    *timestamp_us = MAX30205_TIMESTAMP_US(periodic->handle);                           /* sample time */
+    periodic->next_us += periodic->period_us;                                          /* next deadline */
+    
+    return (res != 0) ? 1 : 0;                                                        /* return the result */
+}
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *periodic pointer to a max30205 periodic structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 periodic sampler is not inited
+ * @note       none
+ */
+uint8_t max30205_periodic_get_stats(max30205_periodic_t *periodic, max30205_periodic_stats_t *stats)
+{
+    if ((periodic == NULL) || (stats == NULL))        /* check handle */
+    {
+        return 2;                                     /* return error */
+    }
+    if (periodic->inited != 1)                        /* check the sampler */
+    {
+        return 3;                                     /* return error */
+    }
+    
+    *stats = periodic->stats;                         /* copy statistics */
+    
+    return 0;                                         /* success return 0 */
+}
@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_periodic.h
+ * @brief     driver max30205 periodic header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MAX30205_PERIODIC_H
+#define DRIVER_MAX30205_PERIODIC_H
+
+#include "driver_max30205.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup max30205_periodic_driver
+ * @{
+ */
+
+/**
+ * @brief max30205 periodic statistics structure definition
+ */
+typedef struct max30205_periodic_stats_s
+{
+    uint32_t samples;              /**< samples taken */
+    uint32_t overruns;             /**< calls that missed a whole period */
+    uint32_t skipped;              /**< deadlines dropped after overruns */
+    int32_t jitter_min_us;         /**< earliest wake up against the deadline */
+    int32_t jitter_max_us;         /**< latest wake up against the deadline */
+    float jitter_mean_us;          /**< mean wake up delay */
+} max30205_periodic_stats_t;
+
+/**
+ * @brief max30205 periodic structure definition
+ */
+typedef struct max30205_periodic_s
+{
+    max30205_handle_t *handle;                                                  /**< max30205 handle */
+    uint8_t (*read)(max30205_handle_t *handle, int16_t *raw, float *s);         /**< point to a read function address */
+    void (*sleep_until_us)(uint64_t deadline_us);                               /**< point to a sleep_until_us function address */
+    uint32_t period_us;                                                         /**< sampling period */
+    uint64_t next_us;                                                           /**< next deadline */
+    int64_t jitter_sum_us;                                                      /**< wake up delay sum */
+    max30205_periodic_stats_t stats;                                            /**< statistics */
+    uint8_t started;                                                            /**< started flag */
+    uint8_t inited;                                                             /**< inited flag */
+} max30205_periodic_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup max30205_periodic_link_driver max30205 periodic link driver function
+ * @brief    max30205 periodic link driver modules
+ * @ingroup  max30205_periodic_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize max30205_periodic_t structure
+ * @param[in] PERIODIC pointer to a max30205 periodic structure
+ * @param[in] STRUCTURE max30205_periodic_t
+ * @note      none
+ */
+#define DRIVER_MAX30205_PERIODIC_LINK_INIT(PERIODIC, STRUCTURE)                memset(PERIODIC, 0, sizeof(STRUCTURE))
+
+/**
+ * @brief     link sleep_until_us function
+ * @param[in] PERIODIC pointer to a max30205 periodic structure
+ * @param[in] FUC pointer to a sleep_until_us function address
+ * @note      it sleeps until an absolute time on the handle timestamp_us clock, clock_nanosleep with
+ *            TIMER_ABSTIME on linux or a timer wake up on a microcontroller
+ */
+#define DRIVER_MAX30205_PERIODIC_LINK_SLEEP_UNTIL_US(PERIODIC, FUC)            (PERIODIC)->sleep_until_us = FUC
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup max30205_periodic_driver max30205 periodic driver function
+ * @brief    max30205 periodic driver modules
+ * @ingroup  max30205_driver
+ * @{
+ */
+
+/**
+ * @brief     init the periodic sampler
+ * @param[in] *periodic pointer to a max30205 periodic structure
+ * @param[in] *handle pointer to an initialized max30205 handle with a linked timestamp_us
+ * @param[in] *read pointer to a read function, max30205_continuous_read or max30205_single_read
+ * @param[in] period_us sampling period
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 period is invalid
+ * @note      none
+ */
+uint8_t max30205_periodic_init(max30205_periodic_t *periodic, max30205_handle_t *handle,
+                               uint8_t (*read)(max30205_handle_t *handle, int16_t *raw, float *s),
+                               uint32_t period_us);
+
+/**
+ * @brief      wait for the next deadline and read
+ * @param[in]  *periodic pointer to a max30205 periodic structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *s pointer to a converted data buffer
+ * @param[out] *timestamp_us pointer to a timestamp buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 periodic sampler is not inited
+ * @note       deadlines are absolute, so the read time does not shift the period, the first call
+ *             reads at once, a call later than the deadline reads at once, and a call that missed a
+ *             whole period counts an overrun and drops the missed deadlines without changing the phase
+ */
+uint8_t max30205_periodic_read(max30205_periodic_t *periodic, int16_t *raw, float *s, uint64_t *timestamp_us);
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *periodic pointer to a max30205 periodic structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 periodic sampler is not inited
+ * @note       none
+ */
+uint8_t max30205_periodic_get_stats(max30205_periodic_t *periodic, max30205_periodic_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,318 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_power.c
+ * @brief     driver max30205 power source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_max30205_power.h"
+
+/**
+ * @brief chip power information definition
+ */
+#define ACTIVE_CURRENT_UA           600.0f        /**< typical supply current while converting */
+#define SHUTDOWN_CURRENT_UA         1.65f         /**< typical shutdown supply current */
+#define CONVERSION_TIME_MS          50            /**< max conversion time */
+
+/**
+ * @brief     choose the mode for a demand
+ * @param[in] *sensor pointer to a max30205 power sensor structure
+ * @return    chosen mode
+ * @note      one-shot is entered at a period of the conversion time plus the bus margin plus the
+ *            hysteresis and left below the conversion time plus the bus margin
+ */
+static max30205_power_mode_t a_max30205_power_choose(max30205_power_sensor_t *sensor)
+{
+    if (sensor->demand_ms == 0)                                                        /* no demand */
+    {
+        return MAX30205_POWER_MODE_OFF;                                                /* shutdown */
+    }
+#if (MAX30205_CONFIG_SINGLE_READ == 1)
+    if (sensor->mode == MAX30205_POWER_MODE_ONE_SHOT)                                  /* already one-shot */
+    {
+        if (sensor->demand_ms >= CONVERSION_TIME_MS + MAX30205_POWER_BUS_MARGIN_MS)    /* a conversion still fits */
+        {
+            return MAX30205_POWER_MODE_ONE_SHOT;                                       /* keep it */
+        }
+    }
+    else if (sensor->demand_ms >= CONVERSION_TIME_MS + MAX30205_POWER_BUS_MARGIN_MS
+                                  + MAX30205_POWER_HYSTERESIS_MS)                      /* clearly slow enough */
+    {
+        return MAX30205_POWER_MODE_ONE_SHOT;                                           /* one-shot */
+    }
+#endif
+    
+    return MAX30205_POWER_MODE_CONTINUOUS;                                             /* continuous */
+}
+
+/**
+ * @brief     init the power scheduler
+ * @param[in] *power pointer to a max30205 power structure
+ * @param[in] supply_mv supply voltage used by the energy estimate
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 supply voltage is invalid
+ * @note      none
+ */
+uint8_t max30205_power_init(max30205_power_t *power, uint16_t supply_mv)
+{
+    if (power == NULL)                                 /* check handle */
+    {
+        return 2;                                      /* return error */
+    }
+    if (supply_mv == 0)                                /* check the supply */
+    {
+        return 4;                                      /* return error */
+    }
+    
+    memset(power, 0, sizeof(max30205_power_t));        /* clear the scheduler */
+    power->supply_mv = supply_mv;                      /* set supply */
+    power->inited = 1;                                 /* flag inited */
+    
+    return 0;                                          /* success return 0 */
+}
+
+/**
+ * @brief      add a sensor
+ * @param[in]  *power pointer to a max30205 power structure
+ * @param[in]  *handle pointer to an initialized max30205 handle
+ * @param[out] *index pointer to a sensor index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 power down failed
+ *             - 2 handle is NULL
+ *             - 3 power scheduler is not inited
+ *             - 5 sensors are full
+ * @note       the sensor is shut down until a consumer asks for samples
+ */
+uint8_t max30205_power_add(max30205_power_t *power, max30205_handle_t *handle, uint8_t *index)
+{
+    max30205_power_sensor_t *sensor;
+    
+    if ((power == NULL) || (handle == NULL) || (index == NULL))        /* check handle */
+    {
+        return 2;                                                      /* return error */
+    }
+    if (power->inited != 1)                                            /* check the scheduler */
+    {
+        return 3;                                                      /* return error */
+    }
+    if (power->num >= MAX30205_CONFIG_GROUP_MAX)                       /* check the sensors */
+    {
+        return 5;                                                      /* return error */
+    }
+    
+    if (max30205_power_down(handle) != 0)                              /* shut down */
+    {
+        return 1;                                                      /* return error */
+    }
+    sensor = &power->sensor[power->num];                               /* get the sensor */
+    memset(sensor, 0, sizeof(max30205_power_sensor_t));                /* clear the sensor */
+    sensor->handle = handle;                                           /* set handle */
+    sensor->mode = MAX30205_POWER_MODE_OFF;                            /* no demand */
+    *index = power->num;                                               /* output index */
+    power->num++;                                                      /* add the sensor */
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief     set the sample period a consumer needs
+ * @param[in] *power pointer to a max30205 power structure
+ * @param[in] index sensor index
+ * @param[in] consumer consumer index
+ * @param[in] period_ms sample period, 0 drops the demand
+ * @return    status code
+ *            - 0 success
+ *            - 1 mode switch failed
+ *            - 2 handle is NULL
+ *            - 3 power scheduler is not inited
+ *            - 4 index or consumer is invalid
+ * @note      the sensor runs one-shots with shutdown in between when the shortest period leaves room
+ *            for a full conversion, otherwise it converts continuously, the switch is applied at once
+ */
+uint8_t max30205_power_request(max30205_power_t *power, uint8_t index, uint8_t consumer, uint32_t period_ms)
+{
+    max30205_power_sensor_t *sensor;
+    max30205_power_mode_t mode;
+    uint8_t res;
+    uint8_t i;
+    
+    if (power == NULL)                                                                  /* check handle */
+    {
+        return 2;                                                                       /* return error */
+    }
+    if (power->inited != 1)                                                             /* check the scheduler */
+    {
+        return 3;                                                                       /* return error */
+    }
+    if ((index >= power->num) || (consumer >= MAX30205_POWER_CONSUMER_MAX))             /* check the index */
+    {
+        return 4;                                                                       /* return error */
+    }
+    
+    sensor = &power->sensor[index];                                                     /* get the sensor */
+    sensor->period_ms[consumer] = period_ms;                                            /* set the demand */
+    sensor->demand_ms = 0;                                                              /* no demand */
+    for (i = 0; i < MAX30205_POWER_CONSUMER_MAX; i++)                                   /* every consumer */
+    {
+        if ((sensor->period_ms[i] != 0) &&
+            ((sensor->demand_ms == 0) || (sensor->period_ms[i] < sensor->demand_ms)))   /* shortest period */
+        {
+            sensor->demand_ms = sensor->period_ms[i];                                   /* save demand */
+        }
+    }
+    mode = a_max30205_power_choose(sensor);                                             /* choose the mode */
+    if (mode == sensor->mode)                                                           /* no change */
+    {
+        return 0;                                                                       /* success return 0 */
+    }
+    if (mode == MAX30205_POWER_MODE_CONTINUOUS)                                         /* continuous */
+    {
+        res = max30205_start_continuous_read(sensor->handle);                           /* start converting */
+    }
+    else
+    {
+        res = max30205_power_down(sensor->handle);                                      /* shut down */
+    }
+    if (res != 0)                                                                       /* check result */
+    {
+        return 1;                                                                       /* return error */
+    }
+    sensor->mode = mode;                                                                /* save mode */
+    sensor->switches++;                                                                 /* count switches */
+    
+    return 0;                                                                           /* success return 0 */
+}
+
+/**
+ * @brief      read a sample in the current mode
+ * @param[in]  *power pointer to a max30205 power structure
+ * @param[in]  index sensor index
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *s pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 power scheduler is not inited
+ *             - 4 index is invalid or the sensor has no demand
+ * @note       a one-shot read blocks for the conversion time
+ */
+uint8_t max30205_power_read(max30205_power_t *power, uint8_t index, int16_t *raw, float *s)
+{
+    max30205_power_sensor_t *sensor;
+    
+    if (power == NULL)                                                                 /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (power->inited != 1)                                                            /* check the scheduler */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (index >= power->num)                                                           /* check the index */
+    {
+        return 4;                                                                      /* return error */
+    }
+    
+    sensor = &power->sensor[index];                                                    /* get the sensor */
+    if (sensor->mode == MAX30205_POWER_MODE_CONTINUOUS)                                /* continuous */
+    {
+        return (max30205_continuous_read(sensor->handle, raw, s) != 0) ? 1 : 0;        /* read */
+    }
+#if (MAX30205_CONFIG_SINGLE_READ == 1)
+    if (sensor->mode == MAX30205_POWER_MODE_ONE_SHOT)                                  /* one-shot */
+    {
+        return (max30205_single_read(sensor->handle, raw, s) != 0) ? 1 : 0;            /* convert and read */
+    }
+#endif
+    
+    return 4;                                                                          /* return error */
+}
+
+/**
+ * @brief      get the energy estimate
+ * @param[in]  *power pointer to a max30205 power structure
+ * @param[in]  index sensor index
+ * @param[out] *mode pointer to a mode buffer
+ * @param[out] *current_ua pointer to an average supply current buffer
+ * @param[out] *energy_uj pointer to an energy per sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 power scheduler is not inited
+ *             - 4 index is invalid
+ * @note       datasheet typical currents are used and the bus current is not included
+ */
+uint8_t max30205_power_get_estimate(max30205_power_t *power, uint8_t index, max30205_power_mode_t *mode,
+                                    float *current_ua, float *energy_uj)
+{
+    max30205_power_sensor_t *sensor;
+    float period_s;
+    float active_s;
+    
+    if ((power == NULL) || (mode == NULL) || (current_ua == NULL) || (energy_uj == NULL))   /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (power->inited != 1)                                                                 /* check the scheduler */
+    {
+        return 3;                                                                           /* return error */
+    }
+    if (index >= power->num)                                                                /* check the index */
+    {
+        return 4;                                                                           /* return error */
+    }
+    
+    sensor = &power->sensor[index];                                                         /* get the sensor */
+    *mode = sensor->mode;                                                                   /* output mode */
+    period_s = (float)sensor->demand_ms / 1000.0f;                                          /* sample period */
+    if (sensor->mode == MAX30205_POWER_MODE_CONTINUOUS)                                     /* continuous */
+    {
+        *current_ua = ACTIVE_CURRENT_UA;                                                    /* always converting */
+    }
+    else if ((sensor->mode == MAX30205_POWER_MODE_ONE_SHOT) && (period_s > 0.0f))           /* one-shot */
+    {
+        active_s = (float)CONVERSION_TIME_MS / 1000.0f;                                     /* conversion time */
+        *current_ua = (ACTIVE_CURRENT_UA * active_s +
+                       SHUTDOWN_CURRENT_UA * (period_s - active_s)) / period_s;             /* duty cycled current */
+    }
+    else
+    {
+        *current_ua = SHUTDOWN_CURRENT_UA;                                                  /* shutdown */
+    }
+    *energy_uj = *current_ua * ((float)power->supply_mv / 1000.0f) * period_s;              /* energy per sample */
+    
+    return 0;                                                                               /* success return 0 */
+}
@@ -0,0 +1,201 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_power.h
+ * @brief     driver max30205 power header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MAX30205_POWER_H
+#define DRIVER_MAX30205_POWER_H
+
+#include "driver_max30205.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup max30205_power_driver
+ * @{
+ */
+
+/**
+ * @brief max30205 power consumer number definition
+ */
+#ifndef MAX30205_POWER_CONSUMER_MAX
+    #define MAX30205_POWER_CONSUMER_MAX 4        /**< consumers of one sensor */
+#endif
+
+/**
+ * @brief max30205 power hysteresis definition
+ */
+#ifndef MAX30205_POWER_HYSTERESIS_MS
+    #define MAX30205_POWER_HYSTERESIS_MS 20        /**< extra period needed to leave the continuous mode */
+#endif
+
+/**
+ * @brief max30205 power bus margin definition
+ */
+#ifndef MAX30205_POWER_BUS_MARGIN_MS
+    #define MAX30205_POWER_BUS_MARGIN_MS 5        /**< time of the one-shot bus transactions and scheduling on top of a conversion */
+#endif
+
+/**
+ * @brief max30205 power mode enumeration definition
+ */
+typedef enum
+{
+    MAX30205_POWER_MODE_OFF        = 0x00,        /**< no demand, shutdown */
+    MAX30205_POWER_MODE_CONTINUOUS = 0x01,        /**< continuous conversion */
+    MAX30205_POWER_MODE_ONE_SHOT   = 0x02,        /**< one-shot with shutdown in between */
+} max30205_power_mode_t;
+
+/**
+ * @brief max30205 power sensor structure definition
+ */
+typedef struct max30205_power_sensor_s
+{
+    max30205_handle_t *handle;                                    /**< max30205 handle */
+    uint32_t period_ms[MAX30205_POWER_CONSUMER_MAX];              /**< requested period of each consumer, 0 is no demand */
+    uint32_t demand_ms;                                           /**< shortest requested period */
+    max30205_power_mode_t mode;                                   /**< current mode */
+    uint32_t switches;                                            /**< mode switches */
+} max30205_power_sensor_t;
+
+/**
+ * @brief max30205 power structure definition
+ */
+typedef struct max30205_power_s
+{
+    max30205_power_sensor_t sensor[MAX30205_CONFIG_GROUP_MAX];        /**< sensors */
+    uint8_t num;                                                      /**< sensor number */
+    uint16_t supply_mv;                                               /**< supply voltage */
+    uint8_t inited;                                                   /**< inited flag */
+} max30205_power_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup max30205_power_driver max30205 power driver function
+ * @brief    max30205 power driver modules
+ * @ingroup  max30205_driver
+ * @{
+ */
+
+/**
+ * @brief     init the power scheduler
+ * @param[in] *power pointer to a max30205 power structure
+ * @param[in] supply_mv supply voltage used by the energy estimate
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 supply voltage is invalid
+ * @note      none
+ */
+uint8_t max30205_power_init(max30205_power_t *power, uint16_t supply_mv);
+
+/**
+ * @brief      add a sensor
+ * @param[in]  *power pointer to a max30205 power structure
+ * @param[in]  *handle pointer to an initialized max30205 handle
+ * @param[out] *index pointer to a sensor index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 power down failed
+ *             - 2 handle is NULL
+ *             - 3 power scheduler is not inited
+ *             - 5 sensors are full
+ * @note       the sensor is shut down until a consumer asks for samples
+ */
+uint8_t max30205_power_add(max30205_power_t *power, max30205_handle_t *handle, uint8_t *index);
+
+/**
+ * @brief     set the sample period a consumer needs
+ * @param[in] *power pointer to a max30205 power structure
+ * @param[in] index sensor index
+ * @param[in] consumer consumer index
+ * @param[in] period_ms sample period, 0 drops the demand
+ * @return    status code
+ *            - 0 success
+ *            - 1 mode switch failed
+ *            - 2 handle is NULL
+ *            - 3 power scheduler is not inited
+ *            - 4 index or consumer is invalid
+ * @note      the sensor runs one-shots with shutdown in between when the shortest period leaves room
+ *            for a full conversion, otherwise it converts continuously, the switch is applied at once
+ */
+uint8_t max30205_power_request(max30205_power_t *power, uint8_t index, uint8_t consumer, uint32_t period_ms);
+
+/**
+ * @brief      read a sample in the current mode
+ * @param[in]  *power pointer to a max30205 power structure
+ * @param[in]  index sensor index
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *s pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 power scheduler is not inited
+ *             - 4 index is invalid or the sensor has no demand
+ * @note       a one-shot read blocks for the conversion time
+ */
+uint8_t max30205_power_read(max30205_power_t *power, uint8_t index, int16_t *raw, float *s);
+
+/**
+ * @brief      get the energy estimate
+ * @param[in]  *power pointer to a max30205 power structure
+ * @param[in]  index sensor index
+ * @param[out] *mode pointer to a mode buffer
+ * @param[out] *current_ua pointer to an average supply current buffer
+ * @param[out] *energy_uj pointer to an energy per sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 power scheduler is not inited
+ *             - 4 index is invalid
+ * @note       datasheet typical currents are used and the bus current is not included
+ */
+uint8_t max30205_power_get_estimate(max30205_power_t *power, uint8_t index, max30205_power_mode_t *mode,
+                                    float *current_ua, float *energy_uj);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
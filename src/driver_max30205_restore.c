@@ -0,0 +1,299 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_restore.c
+ * @brief     driver max30205 restore source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_max30205_restore.h"
+
+/**
+ * @brief chip register definition
+ */
+#define MAX30205_REG_CONF          0x01        /**< configuration register */
+#define MAX30205_REG_THYST         0x02        /**< hysteresis register */
+#define MAX30205_REG_TOS           0x03        /**< overtemperature register */
+
+/**
+ * @brief     write the cached configuration again
+ * @param[in] *sensor pointer to a max30205 restore sensor structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 restore failed
+ * @note      none
+ */
+static uint8_t a_max30205_restore_apply(max30205_restore_sensor_t *sensor)
+{
+    max30205_attach_report_t report;
+    
+    sensor->handle->reg = sensor->conf & 0x7E;                            /* restore the mirror */
+    if (max30205_attach(sensor->handle, sensor->conf & 0x01,
+                        sensor->thyst, sensor->tos, &report) != 0)        /* write the differences */
+    {
+        return 1;                                                         /* return error */
+    }
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief     init the reset detector
+ * @param[in] *restore pointer to a max30205 restore structure
+ * @param[in] ratio sample reads per register check
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 ratio is invalid
+ * @note      the checks cost at most one short read per ratio sample reads,
+ *            a reset is found within 3 * sensors * ratio sample reads
+ */
+uint8_t max30205_restore_init(max30205_restore_t *restore, uint16_t ratio)
+{
+    if (restore == NULL)                                   /* check handle */
+    {
+        return 2;                                          /* return error */
+    }
+    if (ratio == 0)                                        /* check ratio */
+    {
+        return 4;                                          /* return error */
+    }
+    
+    memset(restore, 0, sizeof(max30205_restore_t));        /* clear the detector */
+    restore->ratio = ratio;                                /* set ratio */
+    restore->next_reg = MAX30205_REG_CONF;                 /* first register */
+    restore->inited = 1;                                   /* flag inited */
+    
+    return 0;                                              /* success return 0 */
+}
+
+/**
+ * @brief      add a sensor and apply its configuration
+ * @param[in]  *restore pointer to a max30205 restore structure
+ * @param[in]  *handle pointer to an initialized and configured max30205 handle
+ * @param[in]  shutdown 1 for the shutdown mode, 0 for continuous conversions
+ * @param[in]  low_threshold hysteresis register
+ * @param[in]  high_threshold overtemperature register
+ * @param[out] *index pointer to a sensor index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 attach failed
+ *             - 2 handle is NULL
+ *             - 3 reset detector is not inited or handle is not initialized
+ *             - 5 sensors are full
+ * @note       the configuration is taken from the register mirror of the handle and written
+ *             with max30205_attach, shutdown must match the read mode the sensor is used in
+ */
+uint8_t max30205_restore_add(max30205_restore_t *restore, max30205_handle_t *handle, uint8_t shutdown,
+                             int16_t low_threshold, int16_t high_threshold, uint8_t *index)
+{
+    max30205_restore_sensor_t *sensor;
+    
+    if ((restore == NULL) || (handle == NULL) || (index == NULL))                       /* check handle */
+    {
+        return 2;                                                                       /* return error */
+    }
+    if ((restore->inited != 1) || (handle->inited != 1))                                /* check initialization */
+    {
+        return 3;                                                                       /* return error */
+    }
+    if (restore->num >= MAX30205_CONFIG_GROUP_MAX)                                      /* check the number */
+    {
+        return 5;                                                                       /* return error */
+    }
+    
+    sensor = &restore->sensor[restore->num];                                            /* get sensor */
+    memset(sensor, 0, sizeof(max30205_restore_sensor_t));                               /* clear the sensor */
+    sensor->handle = handle;                                                            /* set handle */
+    sensor->conf = (uint8_t)((handle->reg & 0x7E) | ((shutdown != 0) ? 0x01 : 0x00));   /* cache conf */
+    sensor->thyst = low_threshold;                                                      /* cache thyst */
+    sensor->tos = high_threshold;                                                       /* cache tos */
+    if (a_max30205_restore_apply(sensor) != 0)                                          /* apply it */
+    {
+        return 1;                                                                       /* return error */
+    }
+    *index = restore->num;                                                              /* set index */
+    restore->num++;                                                                     /* add one */
+    
+    return 0;                                                                           /* success return 0 */
+}
+
+/**
+ * @brief     check the next register
+ * @param[in] *restore pointer to a max30205 restore structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 check or restore failed
+ *            - 2 handle is NULL
+ *            - 3 reset detector is not inited
+ *            - 4 no sensor
+ * @note      the sensors and their three registers are checked in turn, a register that lost its
+ *            value means the sensor was reset and the cached configuration is written again
+ */
+uint8_t max30205_restore_check(max30205_restore_t *restore)
+{
+    max30205_restore_sensor_t *sensor;
+    uint8_t buf[2];
+    uint8_t reg;
+    uint8_t lost;
+    
+    if (restore == NULL)                                                               /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (restore->inited != 1)                                                          /* check initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (restore->num == 0)                                                             /* check the number */
+    {
+        return 4;                                                                      /* return error */
+    }
+    
+    sensor = &restore->sensor[restore->next_sensor];                                   /* get sensor */
+    reg = restore->next_reg;                                                           /* get register */
+    restore->next_reg++;                                                               /* next register */
+    if (restore->next_reg > MAX30205_REG_TOS)                                          /* last register */
+    {
+        restore->next_reg = MAX30205_REG_CONF;                                         /* first register */
+        restore->next_sensor = (uint8_t)((restore->next_sensor + 1) % restore->num);   /* next sensor */
+    }
+    restore->checks++;                                                                 /* count check */
+    memset(buf, 0, sizeof(uint8_t) * 2);                                               /* clear the buffer */
+    if (reg == MAX30205_REG_CONF)                                                      /* configuration */
+    {
+        if (MAX30205_IIC_READ(sensor->handle, reg, (uint8_t *)buf, 1) != 0)            /* read one byte */
+        {
+            return 1;                                                                  /* return error */
+        }
+        lost = ((buf[0] & 0x7F) != sensor->conf);                                      /* compare */
+    }
+    else
+    {
+        if (MAX30205_IIC_READ(sensor->handle, reg, (uint8_t *)buf, 2) != 0)            /* read two bytes */
+        {
+            return 1;                                                                  /* return error */
+        }
+        lost = ((int16_t)(((uint16_t)buf[0]) << 8 | buf[1]) !=
+                ((reg == MAX30205_REG_THYST) ? sensor->thyst : sensor->tos));          /* compare */
+    }
+    if (lost != 0)                                                                     /* the sensor was reset */
+    {
+        sensor->resets++;                                                              /* count reset */
+        MAX30205_DEBUG_PRINT(sensor->handle, "max30205: reset detected.\n");           /* reset detected */
+        
+        return a_max30205_restore_apply(sensor);                                       /* restore */
+    }
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      read a sample and run the due check first
+ * @param[in]  *restore pointer to a max30205 restore structure
+ * @param[in]  index sensor index
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *s pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 reset detector is not inited
+ *             - 4 index is invalid
+ * @note       a failed check does not fail the read, it is retried by the next due check
+ */
+uint8_t max30205_restore_read(max30205_restore_t *restore, uint8_t index, int16_t *raw, float *s)
+{
+    if ((restore == NULL) || (raw == NULL) || (s == NULL))                         /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (restore->inited != 1)                                                      /* check initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (index >= restore->num)                                                     /* check index */
+    {
+        return 4;                                                                  /* return error */
+    }
+    
+    restore->count++;                                                              /* count toward the check */
+    if (restore->count >= restore->ratio)                                          /* check due */
+    {
+        restore->count = 0;                                                        /* restart */
+        (void)max30205_restore_check(restore);                                     /* check one register */
+    }
+    restore->reads++;                                                              /* count read */
+    
+#if (MAX30205_CONFIG_SINGLE_READ == 1)
+    if ((restore->sensor[index].conf & 0x01) != 0)                                 /* shutdown mode */
+    {
+        return max30205_single_read(restore->sensor[index].handle, raw, s);        /* one-shot read */
+    }
+#endif
+    return max30205_continuous_read(restore->sensor[index].handle, raw, s);        /* read */
+}
+
+/**
+ * @brief      get the check statistics
+ * @param[in]  *restore pointer to a max30205 restore structure
+ * @param[out] *reads pointer to a sample reads buffer
+ * @param[out] *checks pointer to a register checks buffer
+ * @param[out] *resets pointer to a detected resets buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 reset detector is not inited
+ * @note       resets is the sum over every sensor
+ */
+uint8_t max30205_restore_get_stats(max30205_restore_t *restore, uint32_t *reads, uint32_t *checks, uint32_t *resets)
+{
+    uint8_t i;
+    
+    if ((restore == NULL) || (reads == NULL) || (checks == NULL) || (resets == NULL))   /* check handle */
+    {
+        return 2;                                                                       /* return error */
+    }
+    if (restore->inited != 1)                                                           /* check initialization */
+    {
+        return 3;                                                                       /* return error */
+    }
+    
+    *reads = restore->reads;                                                            /* get reads */
+    *checks = restore->checks;                                                          /* get checks */
+    *resets = 0;                                                                        /* clear resets */
+    for (i = 0; i < restore->num; i++)                                                  /* every sensor */
+    {
+        *resets += restore->sensor[i].resets;                                           /* add resets */
+    }
+    
+    return 0;                                                                           /* success return 0 */
+}
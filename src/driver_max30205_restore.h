@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_restore.h
+ * @brief     driver max30205 restore header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MAX30205_RESTORE_H
+#define DRIVER_MAX30205_RESTORE_H
+
+#include "driver_max30205_attach.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup max30205_restore_driver
+ * @{
+ */
+
+/**
+ * @brief max30205 restore sensor structure definition
+ */
+typedef struct max30205_restore_sensor_s
+{
+    max30205_handle_t *handle;        /**< max30205 handle */
+    uint8_t conf;                     /**< cached configuration register */
+    int16_t thyst;                    /**< cached hysteresis register */
+    int16_t tos;                      /**< cached overtemperature register */
+    uint32_t resets;                  /**< detected resets */
+} max30205_restore_sensor_t;
+
+/**
+ * @brief max30205 restore structure definition
+ */
+typedef struct max30205_restore_s
+{
+    max30205_restore_sensor_t sensor[MAX30205_CONFIG_GROUP_MAX];        /**< sensors */
+    uint8_t num;                                                        /**< sensor number */
+    uint16_t ratio;                                                     /**< sample reads per register check */
+    uint16_t count;                                                     /**< sample reads since the last check */
+    uint8_t next_sensor;                                                /**< sensor of the next check */
+    uint8_t next_reg;                                                   /**< register of the next check */
+    uint32_t reads;                                                     /**< sample reads */
+    uint32_t checks;                                                    /**< register checks */
+    uint8_t inited;                                                     /**< inited flag */
+} max30205_restore_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup max30205_restore_driver max30205 restore driver function
+ * @brief    max30205 restore driver modules
+ * @ingroup  max30205_driver
+ * @{
+ */
+
+/**
+ * @brief     init the reset detector
+ * @param[in] *restore pointer to a max30205 restore structure
+ * @param[in] ratio sample reads per register check
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 ratio is invalid
+ * @note      the checks cost at most one short read per ratio sample reads,
+ *            a reset is found within 3 * sensors * ratio sample reads
+ */
+uint8_t max30205_restore_init(max30205_restore_t *restore, uint16_t ratio);
+
+/**
+ * @brief      add a sensor and apply its configuration
+ * @param[in]  *restore pointer to a max30205 restore structure
+ * @param[in]  *handle pointer to an initialized and configured max30205 handle
+ * @param[in]  shutdown 1 for the shutdown mode, 0 for continuous conversions
+ * @param[in]  low_threshold hysteresis register
+ * @param[in]  high_threshold overtemperature register
+ * @param[out] *index pointer to a sensor index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 attach failed
+ *             - 2 handle is NULL
+ *             - 3 reset detector is not inited or handle is not initialized
+ *             - 5 sensors are full
+ * @note       the configuration is taken from the register mirror of the handle and written
+ *             with max30205_attach, shutdown must match the read mode the sensor is used in
+ */
+uint8_t max30205_restore_add(max30205_restore_t *restore, max30205_handle_t *handle, uint8_t shutdown,
+                             int16_t low_threshold, int16_t high_threshold, uint8_t *index);
+
+/**
+ * @brief     check the next register
+ * @param[in] *restore pointer to a max30205 restore structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 check or restore failed
+ *            - 2 handle is NULL
+ *            - 3 reset detector is not inited
+ *            - 4 no sensor
+ * @note      the sensors and their three registers are checked in turn, a register that lost its
+ *            value means the sensor was reset and the cached configuration is written again
+ */
+uint8_t max30205_restore_check(max30205_restore_t *restore);
+
+/**
+ * @brief      read a sample and run the due check first
+ * @param[in]  *restore pointer to a max30205 restore structure
+ * @param[in]  index sensor index
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *s pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 reset detector is not inited
+ *             - 4 index is invalid
+ * @note       a failed check does not fail the read, it is retried by the next due check,
+ *             a sensor added in the shutdown mode is read with a one-shot
+ */
+uint8_t max30205_restore_read(max30205_restore_t *restore, uint8_t index, int16_t *raw, float *s);
+
+/**
+ * @brief      get the check statistics
+ * @param[in]  *restore pointer to a max30205 restore structure
+ * @param[out] *reads pointer to a sample reads buffer
+ * @param[out] *checks pointer to a register checks buffer
+ * @param[out] *resets pointer to a detected resets buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 reset detector is not inited
+ * @note       resets is the sum over every sensor
+ */
+uint8_t max30205_restore_get_stats(max30205_restore_t *restore, uint32_t *reads, uint32_t *checks, uint32_t *resets);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,275 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_scan.c
+ * @brief     driver max30205 scan source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_max30205_scan.h"
+
+/**
+ * @brief chip register definition
+ */
+#define MAX30205_REG_TEMP          0x00        /**< temperature register */
+#define MAX30205_REG_CONF          0x01        /**< configuration register */
+#define MAX30205_REG_THYST         0x02        /**< hysteresis register */
+#define MAX30205_REG_TOS           0x03        /**< overtemperature register */
+
+/**
+ * @brief chip power-on reset definition
+ */
+#define MAX30205_POR_CONF          0x00          /**< configuration reset value */
+#define MAX30205_POR_THYST         0x4B00        /**< hysteresis reset value, 75C */
+#define MAX30205_POR_TOS           0x5000        /**< overtemperature reset value, 80C */
+
+/**
+ * @brief identity definition
+ */
+#define MAX30205_SCAN_PATTERN      0x0055        /**< low bits flipped in the hysteresis register */
+#define MAX30205_SCAN_TEMP_MIN     (-40)         /**< lowest plausible temperature in C */
+#define MAX30205_SCAN_TEMP_MAX     125           /**< highest plausible temperature in C */
+#define MAX30205_SCAN_FINE_MASK    0x7F          /**< bits an lm75 class part always reads as 0 */
+
+/**
+ * @brief address list definition, indexed by the pin code
+ */
+static const max30205_address_t gs_address[MAX30205_SCAN_ADDRESS_MAX] =
+{
+    MAX30205_ADDRESS_0,  MAX30205_ADDRESS_1,  MAX30205_ADDRESS_2,  MAX30205_ADDRESS_3,
+    MAX30205_ADDRESS_4,  MAX30205_ADDRESS_5,  MAX30205_ADDRESS_6,  MAX30205_ADDRESS_7,
+    MAX30205_ADDRESS_8,  MAX30205_ADDRESS_9,  MAX30205_ADDRESS_A,  MAX30205_ADDRESS_B,
+    MAX30205_ADDRESS_C,  MAX30205_ADDRESS_D,  MAX30205_ADDRESS_E,  MAX30205_ADDRESS_F,
+    MAX30205_ADDRESS_10, MAX30205_ADDRESS_11, MAX30205_ADDRESS_12, MAX30205_ADDRESS_13,
+    MAX30205_ADDRESS_14, MAX30205_ADDRESS_15, MAX30205_ADDRESS_16, MAX30205_ADDRESS_17,
+    MAX30205_ADDRESS_18, MAX30205_ADDRESS_19, MAX30205_ADDRESS_1A, MAX30205_ADDRESS_1B,
+    MAX30205_ADDRESS_1C, MAX30205_ADDRESS_1D, MAX30205_ADDRESS_1E, MAX30205_ADDRESS_1F,
+};
+
+/**
+ * @brief     check a responder is a max30205 from the read values
+ * @param[in] *device pointer to a max30205 scan device structure
+ * @param[in] *temp pointer to the temperature register read from the responder
+ * @return    status code
+ *            - 0 success
+ *            - 1 not a max30205
+ * @note      the one-shot bit only reads 1 in shutdown, the temperature must be plausible in the
+ *            format the extended bit selects, and a memory whose two byte reads overlap, so that
+ *            the second byte of one register is the first byte of the next, is not a register file
+ */
+static uint8_t a_max30205_scan_check(max30205_scan_device_t *device, uint8_t *temp)
+{
+    int32_t t;
+    
+    if (((device->conf & (1 << 7)) != 0) && ((device->conf & (1 << 0)) == 0))        /* one-shot outside shutdown */
+    {
+        return 1;                                                                    /* return error */
+    }
+    t = (int32_t)((int16_t)(((uint16_t)temp[0]) << 8 | temp[1])) / 256;              /* whole degrees */
+    if ((device->conf & (1 << 5)) != 0)                                              /* extended format */
+    {
+        t += 64;                                                                     /* 64C offset */
+    }
+    if ((t < MAX30205_SCAN_TEMP_MIN) || (t > MAX30205_SCAN_TEMP_MAX))                /* check the range */
+    {
+        return 1;                                                                    /* return error */
+    }
+    if ((temp[1] == device->conf) &&
+        ((uint8_t)(device->thyst & 0xFF) == (uint8_t)((device->tos >> 8) & 0xFF)))   /* sequential memory */
+    {
+        return 1;                                                                    /* return error */
+    }
+    device->fine = (((temp[1] & MAX30205_SCAN_FINE_MASK) != 0) ||
+                    ((device->thyst & MAX30205_SCAN_FINE_MASK) != 0) ||
+                    ((device->tos & MAX30205_SCAN_FINE_MASK) != 0)) ? 1 : 0;         /* 16 bit layout seen */
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     check a responder keeps a written pattern
+ * @param[in] *scan pointer to a max30205 scan structure
+ * @param[in] *probe pointer to a max30205 handle of the responder
+ * @param[in] thyst hysteresis register read from the responder
+ * @return    status code
+ *            - 0 success
+ *            - 1 not a max30205
+ * @note      a pattern with the low bits flipped is written to the hysteresis register, read back
+ *            and the old value is written again, the max30205 keeps all 16 bits while lm75 class
+ *            parts drop the low bits and read only registers do not change
+ */
+static uint8_t a_max30205_scan_write_check(max30205_scan_t *scan, max30205_handle_t *probe, uint16_t thyst)
+{
+    uint16_t pattern;
+    uint8_t buf[2];
+    uint8_t res;
+    
+    pattern = thyst ^ MAX30205_SCAN_PATTERN;                                          /* flip the low bits */
+    buf[0] = (uint8_t)((pattern >> 8) & 0xFF);                                        /* set msb */
+    buf[1] = (uint8_t)(pattern & 0xFF);                                               /* set lsb */
+    scan->transactions++;                                                             /* count transaction */
+    if (MAX30205_IIC_WRITE(probe, MAX30205_REG_THYST, (uint8_t *)buf, 2) != 0)        /* write the pattern */
+    {
+        return 1;                                                                     /* return error */
+    }
+    res = 0;                                                                          /* init 0 */
+    scan->transactions++;                                                             /* count transaction */
+    if (MAX30205_IIC_READ(probe, MAX30205_REG_THYST, (uint8_t *)buf, 2) != 0)         /* read it back */
+    {
+        res = 1;                                                                      /* no answer */
+    }
+    else if ((uint16_t)(((uint16_t)buf[0]) << 8 | buf[1]) != pattern)                 /* check the bits */
+    {
+        res = 1;                                                                      /* bits not kept */
+    }
+    buf[0] = (uint8_t)((thyst >> 8) & 0xFF);                                          /* set msb */
+    buf[1] = (uint8_t)(thyst & 0xFF);                                                 /* set lsb */
+    scan->transactions++;                                                             /* count transaction */
+    if (MAX30205_IIC_WRITE(probe, MAX30205_REG_THYST, (uint8_t *)buf, 2) != 0)        /* restore thyst */
+    {
+        res = 1;                                                                      /* not restored */
+    }
+    
+    return res;                                                                       /* return the result */
+}
+
+/**
+ * @brief      scan the bus for max30205 devices
+ * @param[in]  *handle pointer to an initialized max30205 handle linked to the bus
+ * @param[out] *scan pointer to a max30205 scan structure
+ * @param[in]  por_only 1 keeps only devices holding the power-on reset values
+ * @param[in]  write_check 1 also writes a pattern to the hysteresis register of every responder
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       every address gets one single byte configuration read and only the responders are
+ *             read further, a responder is accepted from reads only when the temperature,
+ *             hysteresis and overtemperature registers answer, the one-shot bit and the temperature
+ *             fit the configuration and the reads do not overlap like a memory, with por_only it
+ *             must also hold the power-on reset values, every found device gets a copy of the
+ *             handle with its address and the configuration mirrored, the address range is shared
+ *             with eeproms and parts such as lm75, so the read checks can still accept a foreign
+ *             part, fine marks a 16 bit threshold or temperature layout that an lm75 class part
+ *             never shows, write_check writes a pattern to register 0x02 of every responder and
+ *             restores it, never set it on a bus with an eeprom or other writable part
+ */
+uint8_t max30205_scan(max30205_handle_t *handle, max30205_scan_t *scan, uint8_t por_only, uint8_t write_check)
+{
+    max30205_handle_t *probe;
+    max30205_scan_device_t *device;
+    uint8_t temp[2];
+    uint8_t buf[2];
+    uint8_t conf;
+    uint8_t i;
+    
+    if ((handle == NULL) || (scan == NULL))                                          /* check handle */
+    {
+        return 2;                                                                    /* return error */
+    }
+    if (handle->inited != 1)                                                         /* check handle initialization */
+    {
+        return 3;                                                                    /* return error */
+    }
+    
+    memset(scan, 0, sizeof(max30205_scan_t));                                        /* clear the result */
+    for (i = 0; i < MAX30205_SCAN_ADDRESS_MAX; i++)                                  /* every address */
+    {
+        probe = &scan->handle[scan->num];                                            /* next free handle */
+        memcpy(probe, handle, sizeof(max30205_handle_t));                            /* copy the bus links */
+        probe->iic_addr = (uint8_t)gs_address[i];                                    /* set iic address */
+        
+        scan->transactions++;                                                        /* count transaction */
+        if (MAX30205_IIC_READ(probe, MAX30205_REG_CONF, (uint8_t *)&conf, 1) != 0)   /* cheapest read, no print */
+        {
+            continue;                                                                /* nobody there */
+        }
+        device = &scan->device[scan->num];                                           /* get device */
+        device->conf = conf;                                                         /* save conf */
+        scan->transactions++;                                                        /* count transaction */
+        if (MAX30205_IIC_READ(probe, MAX30205_REG_TEMP, (uint8_t *)temp, 2) != 0)    /* read temp */
+        {
+            scan->rejected++;                                                        /* not a max30205 */
+            
+            continue;                                                                /* next */
+        }
+        scan->transactions++;                                                        /* count transaction */
+        if (MAX30205_IIC_READ(probe, MAX30205_REG_THYST, (uint8_t *)buf, 2) != 0)    /* read thyst */
+        {
+            scan->rejected++;                                                        /* not a max30205 */
+            
+            continue;                                                                /* next */
+        }
+        device->thyst = (uint16_t)(((uint16_t)buf[0]) << 8 | buf[1]);                /* save thyst */
+        scan->transactions++;                                                        /* count transaction */
+        if (MAX30205_IIC_READ(probe, MAX30205_REG_TOS, (uint8_t *)buf, 2) != 0)      /* read tos */
+        {
+            scan->rejected++;                                                        /* not a max30205 */
+            
+            continue;                                                                /* next */
+        }
+        device->tos = (uint16_t)(((uint16_t)buf[0]) << 8 | buf[1]);                  /* save tos */
+        if (a_max30205_scan_check(device, (uint8_t *)temp) != 0)                     /* check the read values */
+        {
+            scan->rejected++;                                                        /* not a max30205 */
+            
+            continue;                                                                /* next */
+        }
+        if ((write_check != 0) &&
+            (a_max30205_scan_write_check(scan, probe, device->thyst) != 0))          /* opt-in write check */
+        {
+            scan->rejected++;                                                        /* not a max30205 */
+            
+            continue;                                                                /* next */
+        }
+        device->por = (((conf & (uint8_t)(~(1 << 7))) == MAX30205_POR_CONF) &&
+                       (device->thyst == MAX30205_POR_THYST) &&
+                       (device->tos == MAX30205_POR_TOS)) ? 1 : 0;                   /* check the reset values */
+        if ((por_only != 0) && (device->por == 0))                                   /* not fresh */
+        {
+            scan->rejected++;                                                        /* reject */
+            
+            continue;                                                                /* next */
+        }
+        device->addr_pin = gs_address[i];                                            /* save address */
+        device->pin = i;                                                             /* save pin code */
+        probe->inited = 1;                                                           /* ready to use */
+        probe->reg = conf & (uint8_t)(~(1 << 7));                                    /* mirror conf */
+        scan->num++;                                                                 /* add one */
+    }
+    if (scan->num < MAX30205_SCAN_ADDRESS_MAX)                                       /* unused entry */
+    {
+        memset(&scan->handle[scan->num], 0, sizeof(max30205_handle_t));              /* clear the probe copy */
+        memset(&scan->device[scan->num], 0, sizeof(max30205_scan_device_t));         /* clear the rejected one */
+    }
+    
+    return 0;                                                                        /* success return 0 */
+}
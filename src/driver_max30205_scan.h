@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_scan.h
+ * @brief     driver max30205 scan header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MAX30205_SCAN_H
+#define DRIVER_MAX30205_SCAN_H
+
+#include "driver_max30205.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup max30205_scan_driver
+ * @{
+ */
+
+/**
+ * @brief max30205 scan address number definition
+ */
+#define MAX30205_SCAN_ADDRESS_MAX 32        /**< addresses selectable by the A0, A1 and A2 pins */
+
+/**
+ * @brief max30205 scan device structure definition
+ */
+typedef struct max30205_scan_device_s
+{
+    max30205_address_t addr_pin;        /**< iic address */
+    uint8_t pin;                        /**< pin code, 0x00 - 0x1F as the address enumeration names it */
+    uint8_t conf;                       /**< configuration register */
+    uint16_t thyst;                     /**< hysteresis register */
+    uint16_t tos;                       /**< overtemperature register */
+    uint8_t por;                        /**< registers hold the power-on reset values */
+    uint8_t fine;                       /**< a low bit is set, an lm75 class part never shows one */
+} max30205_scan_device_t;
+
+/**
+ * @brief max30205 scan structure definition
+ */
+typedef struct max30205_scan_s
+{
+    max30205_handle_t handle[MAX30205_SCAN_ADDRESS_MAX];             /**< ready-to-use handles of the found devices */
+    max30205_scan_device_t device[MAX30205_SCAN_ADDRESS_MAX];        /**< found devices */
+    uint8_t num;                                                     /**< found device number */
+    uint8_t rejected;                                                /**< responders that are not a max30205 */
+    uint16_t transactions;                                           /**< bus transactions of the scan */
+} max30205_scan_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup max30205_scan_driver max30205 scan driver function
+ * @brief    max30205 scan driver modules
+ * @ingroup  max30205_driver
+ * @{
+ */
+
+/**
+ * @brief      scan the bus for max30205 devices
+ * @param[in]  *handle pointer to an initialized max30205 handle linked to the bus
+ * @param[out] *scan pointer to a max30205 scan structure
+ * @param[in]  por_only 1 keeps only devices holding the power-on reset values
+ * @param[in]  write_check 1 also writes a pattern to the hysteresis register of every responder
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       every address gets one single byte configuration read and only the responders are
+ *             read further, a responder is accepted from reads only when the temperature,
+ *             hysteresis and overtemperature registers answer, the one-shot bit and the temperature
+ *             fit the configuration and the reads do not overlap like a memory, with por_only it
+ *             must also hold the power-on reset values, every found device gets a copy of the
+ *             handle with its address and the configuration mirrored, the address range is shared
+ *             with eeproms and parts such as lm75, so the read checks can still accept a foreign
+ *             part, fine marks a 16 bit threshold or temperature layout that an lm75 class part
+ *             never shows, write_check writes a pattern to register 0x02 of every responder and
+ *             restores it, never set it on a bus with an eeprom or other writable part
+ */
+uint8_t max30205_scan(max30205_handle_t *handle, max30205_scan_t *scan, uint8_t por_only, uint8_t write_check);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,333 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_tdma.c
+ * @brief     driver max30205 tdma source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_max30205_tdma.h"
+
+/**
+ * @brief     init the tdma scheduler
+ * @param[in] *tdma pointer to a max30205 tdma structure
+ * @param[in] period_us sampling period of every sensor
+ * @param[in] guard_us idle time kept after each slot
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 period is invalid
+ * @note      none
+ */
+uint8_t max30205_tdma_init(max30205_tdma_t *tdma, uint32_t period_us, uint32_t guard_us)
+{
+    if (tdma == NULL)                      /* check handle */
+    {
+        return 2;                          /* return error */
+    }
+    if (tdma->timestamp_us == NULL)        /* check timestamp_us */
+    {
+        return 3;                          /* return error */
+    }
+    if (period_us == 0)                    /* check the period */
+    {
+        return 4;                          /* return error */
+    }
+    
+    tdma->num = 0;                         /* no slot */
+    tdma->next = 0;                        /* first slot */
+    tdma->planned = 0;                     /* not planned */
+    tdma->started = 0;                     /* not started */
+    tdma->period_us = period_us;           /* set period */
+    tdma->guard_us = guard_us;             /* set guard */
+    
+    return 0;                              /* success return 0 */
+}
+
+/**
+ * @brief     add a sensor slot
+ * @param[in] *tdma pointer to a max30205 tdma structure
+ * @param[in] *handle pointer to an initialized and started max30205 handle
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 scheduler is running
+ *            - 5 slots are full
+ * @note      all sensors of one scheduler must be on the same bus
+ */
+uint8_t max30205_tdma_add(max30205_tdma_t *tdma, max30205_handle_t *handle)
+{
+    if ((tdma == NULL) || (handle == NULL))                                 /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (tdma->started != 0)                                                 /* check the scheduler */
+    {
+        return 4;                                                           /* return error */
+    }
+    if (tdma->num >= MAX30205_CONFIG_GROUP_MAX)                             /* check the slots */
+    {
+        return 5;                                                           /* return error */
+    }
+    
+    memset(&tdma->slot[tdma->num], 0, sizeof(max30205_tdma_slot_t));        /* clear the slot */
+    tdma->slot[tdma->num].handle = handle;                                  /* set handle */
+    tdma->num++;                                                            /* add the slot */
+    tdma->planned = 0;                                                      /* plan again */
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief     measure the transaction cost of every slot
+ * @param[in] *tdma pointer to a max30205 tdma structure
+ * @param[in] rounds measured reads per sensor
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ *            - 2 handle is NULL
+ *            - 4 scheduler is running
+ * @note      the worst cost of the rounds is kept
+ */
+uint8_t max30205_tdma_calibrate(max30205_tdma_t *tdma, uint16_t rounds)
+{
+    max30205_tdma_slot_t *slot;
+    uint64_t t0;
+    uint32_t cost;
+    uint16_t r;
+    uint8_t i;
+    
+    if (tdma == NULL)                                                                /* check handle */
+    {
+        return 2;                                                                    /* return error */
+    }
+    if (tdma->started != 0)                                                          /* check the scheduler */
+    {
+        return 4;                                                                    /* return error */
+    }
+    
+    for (r = 0; r < rounds; r++)                                                     /* every round */
+    {
+        for (i = 0; i < tdma->num; i++)                                              /* every slot */
+        {
+            slot = &tdma->slot[i];                                                   /* get the slot */
+            t0 = tdma->timestamp_us();                                               /* start time */
+            if (max30205_continuous_read(slot->handle, &slot->raw, &slot->s) != 0)   /* read */
+            {
+                return 1;                                                            /* return error */
+            }
+            cost = (uint32_t)(tdma->timestamp_us() - t0);                            /* transaction cost */
+            if (cost > slot->cost_us)                                                /* keep the worst */
+            {
+                slot->cost_us = cost;                                                /* save cost */
+            }
+        }
+    }
+    tdma->planned = 0;                                                               /* plan again */
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     assign the slot offsets
+ * @param[in] *tdma pointer to a max30205 tdma structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 scheduler is running
+ *            - 5 period is shorter than the slots
+ * @note      the slots are packed by cost plus guard and the remaining time is spread evenly
+ *            between them, so bus usage is flat over the period
+ */
+uint8_t max30205_tdma_plan(max30205_tdma_t *tdma)
+{
+    uint64_t busy;
+    uint32_t slack;
+    uint32_t offset;
+    uint8_t i;
+    
+    if (tdma == NULL)                                                               /* check handle */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if (tdma->started != 0)                                                         /* check the scheduler */
+    {
+        return 4;                                                                   /* return error */
+    }
+    if (tdma->num == 0)                                                             /* check the slots */
+    {
+        return 5;                                                                   /* return error */
+    }
+    
+    busy = 0;                                                                       /* clear busy time */
+    for (i = 0; i < tdma->num; i++)                                                 /* every slot */
+    {
+        busy += (uint64_t)tdma->slot[i].cost_us + tdma->guard_us;                   /* slot busy time */
+    }
+    if (busy > tdma->period_us)                                                     /* check the period */
+    {
+        return 5;                                                                   /* return error */
+    }
+    slack = (uint32_t)(tdma->period_us - busy) / tdma->num;                         /* free time per slot */
+    offset = 0;                                                                     /* first offset */
+    for (i = 0; i < tdma->num; i++)                                                 /* every slot */
+    {
+        tdma->slot[i].offset_us = offset;                                           /* set offset */
+        tdma->slot[i].window_us = tdma->slot[i].cost_us + tdma->guard_us + slack;   /* set window */
+        offset += tdma->slot[i].window_us;                                          /* next offset */
+    }
+    tdma->slot[tdma->num - 1].window_us += tdma->period_us - offset;                /* the rounding goes to the last slot */
+    tdma->planned = 1;                                                              /* planned */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      run the due slot
+ * @param[in]  *tdma pointer to a max30205 tdma structure
+ * @param[out] *index pointer to an index buffer of the slot that ran
+ * @param[out] *wait_us pointer to a wait time buffer until the next slot
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 scheduler is not planned
+ *             - 4 no slot is due
+ * @note       call it again after wait_us when it returns 4, a slot whose read starts late or
+ *             ends past its window counts an overrun and missed periods are skipped
+ */
+uint8_t max30205_tdma_run(max30205_tdma_t *tdma, uint8_t *index, uint32_t *wait_us)
+{
+    max30205_tdma_slot_t *slot;
+    uint64_t start;
+    uint64_t now;
+    uint64_t late;
+    uint64_t end;
+    
+    if ((tdma == NULL) || (index == NULL) || (wait_us == NULL))                      /* check handle */
+    {
+        return 2;                                                                    /* return error */
+    }
+    if (tdma->planned == 0)                                                          /* check the plan */
+    {
+        return 3;                                                                    /* return error */
+    }
+    
+    now = tdma->timestamp_us();                                                      /* get time */
+    if (tdma->started == 0)                                                          /* first run */
+    {
+        tdma->epoch_us = now;                                                        /* period starts now */
+        tdma->next = 0;                                                              /* first slot */
+        tdma->started = 1;                                                           /* started */
+    }
+    slot = &tdma->slot[tdma->next];                                                  /* get the slot */
+    start = tdma->epoch_us + slot->offset_us;                                        /* slot start */
+    if (now < start)                                                                 /* not due */
+    {
+        *wait_us = (uint32_t)(start - now);                                          /* wait time */
+        
+        return 4;                                                                    /* return error */
+    }
+    late = now - start;                                                              /* start delay */
+    if (late >= tdma->period_us)                                                     /* whole periods missed */
+    {
+        tdma->epoch_us += (late / tdma->period_us) * tdma->period_us;                /* skip them */
+        late = late % tdma->period_us;                                               /* delay in this period */
+        slot->overrun++;                                                             /* missed reads */
+    }
+    
+    slot->res = max30205_continuous_read(slot->handle, &slot->raw, &slot->s);        /* read */
+    end = tdma->timestamp_us();                                                      /* get time */
+    slot->timestamp_us = end;                                                        /* save completion time */
+    slot->last_late_us = (uint32_t)late;                                             /* save delay */
+    slot->last_cost_us = (uint32_t)(end - now);                                      /* save cost */
+    if (slot->last_late_us > slot->max_late_us)                                      /* worst delay */
+    {
+        slot->max_late_us = slot->last_late_us;                                      /* save worst delay */
+    }
+    if (late + (end - now) > slot->window_us)                                        /* ran past the window */
+    {
+        slot->overrun++;                                                             /* overrun */
+    }
+    *index = tdma->next;                                                             /* output index */
+    *wait_us = 0;                                                                    /* no wait */
+    tdma->next++;                                                                    /* next slot */
+    if (tdma->next >= tdma->num)                                                     /* period done */
+    {
+        tdma->next = 0;                                                              /* first slot */
+        tdma->epoch_us += tdma->period_us;                                           /* next period */
+    }
+    
+    return (slot->res != 0) ? 1 : 0;                                                 /* return the result */
+}
+
+/**
+ * @brief      get the scheduler guarantees
+ * @param[in]  *tdma pointer to a max30205 tdma structure
+ * @param[out] *staleness_us pointer to a worst sample age buffer
+ * @param[out] *utilization pointer to a bus utilization buffer in percent
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 scheduler is not planned
+ * @note       the staleness bound holds while no slot overruns
+ */
+uint8_t max30205_tdma_get_bound(max30205_tdma_t *tdma, uint32_t *staleness_us, float *utilization)
+{
+    uint32_t window;
+    uint64_t busy;
+    uint8_t i;
+    
+    if ((tdma == NULL) || (staleness_us == NULL) || (utilization == NULL))        /* check handle */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if (tdma->planned == 0)                                                       /* check the plan */
+    {
+        return 3;                                                                 /* return error */
+    }
+    
+    window = 0;                                                                   /* clear window */
+    busy = 0;                                                                     /* clear busy time */
+    for (i = 0; i < tdma->num; i++)                                               /* every slot */
+    {
+        if (tdma->slot[i].window_us > window)                                     /* widest window */
+        {
+            window = tdma->slot[i].window_us;                                     /* save window */
+        }
+        busy += tdma->slot[i].cost_us;                                            /* bus time */
+    }
+    *staleness_us = tdma->period_us + window;                                     /* a read completes inside its window every period */
+    *utilization = (float)busy * 100.0f / (float)tdma->period_us;                 /* bus utilization */
+    
+    return 0;                                                                     /* success return 0 */
+}
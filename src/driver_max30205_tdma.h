@@ -0,0 +1,214 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_tdma.h
+ * @brief     driver max30205 tdma header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MAX30205_TDMA_H
+#define DRIVER_MAX30205_TDMA_H
+
+#include "driver_max30205.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup max30205_tdma_driver
+ * @{
+ */
+
+/**
+ * @brief max30205 tdma slot structure definition
+ */
+typedef struct max30205_tdma_slot_s
+{
+    max30205_handle_t *handle;        /**< max30205 handle */
+    uint32_t cost_us;                 /**< measured worst transaction cost */
+    uint32_t offset_us;               /**< slot start in the period */
+    uint32_t window_us;               /**< slot length */
+    uint32_t last_late_us;            /**< start delay of the last read */
+    uint32_t max_late_us;             /**< worst start delay */
+    uint32_t last_cost_us;            /**< cost of the last read */
+    uint32_t overrun;                 /**< reads that ran past their slot or were missed */
+    uint64_t timestamp_us;            /**< completion time of the last read */
+    float s;                          /**< last converted temperature */
+    int16_t raw;                      /**< last raw data */
+    uint8_t res;                      /**< last read result */
+} max30205_tdma_slot_t;
+
+/**
+ * @brief max30205 tdma structure definition
+ */
+typedef struct max30205_tdma_s
+{
+    uint64_t (*timestamp_us)(void);                                 /**< point to a timestamp_us function address */
+    max30205_tdma_slot_t slot[MAX30205_CONFIG_GROUP_MAX];           /**< sensor slots */
+    uint8_t num;                                                    /**< slot number */
+    uint8_t next;                                                   /**< next slot */
+    uint8_t planned;                                                /**< planned flag */
+    uint8_t started;                                                /**< started flag */
+    uint32_t period_us;                                             /**< sampling period */
+    uint32_t guard_us;                                              /**< guard time after each slot */
+    uint64_t epoch_us;                                              /**< start of the current period */
+} max30205_tdma_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup max30205_tdma_link_driver max30205 tdma link driver function
+ * @brief    max30205 tdma link driver modules
+ * @ingroup  max30205_tdma_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize max30205_tdma_t structure
+ * @param[in] TDMA pointer to a max30205 tdma structure
+ * @param[in] STRUCTURE max30205_tdma_t
+ * @note      none
+ */
+#define DRIVER_MAX30205_TDMA_LINK_INIT(TDMA, STRUCTURE)         memset(TDMA, 0, sizeof(STRUCTURE))
+
+/**
+ * @brief     link timestamp_us function
+ * @param[in] TDMA pointer to a max30205 tdma structure
+ * @param[in] FUC pointer to a timestamp_us function address
+ * @note      it returns a free running microsecond counter
+ */
+#define DRIVER_MAX30205_TDMA_LINK_TIMESTAMP_US(TDMA, FUC)       (TDMA)->timestamp_us = FUC
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup max30205_tdma_driver max30205 tdma driver function
+ * @brief    max30205 tdma driver modules
+ * @ingroup  max30205_driver
+ * @{
+ */
+
+/**
+ * @brief     init the tdma scheduler
+ * @param[in] *tdma pointer to a max30205 tdma structure
+ * @param[in] period_us sampling period of every sensor
+ * @param[in] guard_us idle time kept after each slot
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 period is invalid
+ * @note      none
+ */
+uint8_t max30205_tdma_init(max30205_tdma_t *tdma, uint32_t period_us, uint32_t guard_us);
+
+/**
+ * @brief     add a sensor slot
+ * @param[in] *tdma pointer to a max30205 tdma structure
+ * @param[in] *handle pointer to an initialized and started max30205 handle
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 scheduler is running
+ *            - 5 slots are full
+ * @note      all sensors of one scheduler must be on the same bus
+ */
+uint8_t max30205_tdma_add(max30205_tdma_t *tdma, max30205_handle_t *handle);
+
+/**
+ * @brief     measure the transaction cost of every slot
+ * @param[in] *tdma pointer to a max30205 tdma structure
+ * @param[in] rounds measured reads per sensor
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ *            - 2 handle is NULL
+ *            - 4 scheduler is running
+ * @note      the worst cost of the rounds is kept
+ */
+uint8_t max30205_tdma_calibrate(max30205_tdma_t *tdma, uint16_t rounds);
+
+/**
+ * @brief     assign the slot offsets
+ * @param[in] *tdma pointer to a max30205 tdma structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 scheduler is running
+ *            - 5 period is shorter than the slots
+ * @note      the slots are packed by cost plus guard and the remaining time is spread evenly
+ *            between them, so bus usage is flat over the period
+ */
+uint8_t max30205_tdma_plan(max30205_tdma_t *tdma);
+
+/**
+ * @brief      run the due slot
+ * @param[in]  *tdma pointer to a max30205 tdma structure
+ * @param[out] *index pointer to an index buffer of the slot that ran
+ * @param[out] *wait_us pointer to a wait time buffer until the next slot
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 scheduler is not planned
+ *             - 4 no slot is due
+ * @note       call it again after wait_us when it returns 4, a slot whose read starts late or
+ *             ends past its window counts an overrun and missed periods are skipped
+ */
+uint8_t max30205_tdma_run(max30205_tdma_t *tdma, uint8_t *index, uint32_t *wait_us);
+
+/**
+ * @brief      get the scheduler guarantees
+ * @param[in]  *tdma pointer to a max30205 tdma structure
+ * @param[out] *staleness_us pointer to a worst sample age buffer
+ * @param[out] *utilization pointer to a bus utilization buffer in percent
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 scheduler is not planned
+ * @note       the staleness bound holds while no slot overruns
+ */
+uint8_t max30205_tdma_get_bound(max30205_tdma_t *tdma, uint32_t *staleness_us, float *utilization);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
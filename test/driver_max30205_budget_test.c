@@ -0,0 +1,194 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_budget_test.c
+ * @brief     driver max30205 budget test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_max30205_budget_test.h"
+#include "driver_max30205_budget.h"
+#include "driver_max30205_test_fixture.h"
+
+static max30205_handle_t gs_handle;        /**< max30205 handle */
+static max30205_budget_t gs_budget;        /**< max30205 budget */
+
+/**
+ * @brief      run a budgeted read
+ * @param[out] *wait_us pointer to a wait time buffer
+ * @return     status code of max30205_budget_continuous_read
+ * @note       none
+ */
+static uint8_t a_max30205_budget_test_read(uint32_t *wait_us)
+{
+    int16_t raw;
+    float s;
+    
+    return max30205_budget_continuous_read(&gs_budget, &gs_handle, (int16_t *)&raw, (float *)&s, wait_us);
+}
+
+/**
+ * @brief     budget test
+ * @param[in] addr iic device address
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the budget runs on a simulated clock that every read advances by its bus time,
+ *            so the occupancy does not depend on the host
+ */
+uint8_t max30205_budget_test(max30205_address_t addr)
+{
+    uint8_t res;
+    uint32_t cost_us;
+    uint32_t transfers;
+    uint32_t wait_us;
+    uint32_t throttled;
+    uint64_t end_us;
+    float actual;
+    float budgeted;
+    
+    /* start budget test */
+    max30205_interface_debug_print("max30205: start budget test.\n");
+    res = max30205_test_fixture_init(&gs_handle, addr, MAX30205_FAULT_QUEUE_1);
+    if (res != 0)
+    {
+        return 1;
+    }
+    DRIVER_MAX30205_BUDGET_LINK_INIT(&gs_budget, max30205_budget_t);
+    DRIVER_MAX30205_BUDGET_LINK_TIMESTAMP_US(&gs_budget, max30205_test_fixture_timestamp_us);
+    
+    /* 100khz bus and 10% occupancy, the first init sets the clock of the cost */
+    res = max30205_budget_init(&gs_budget, 100000, 10.0f, 1);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: budget init failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* a burst of two reads */
+    cost_us = max30205_budget_cost_us(&gs_budget, 1, 2);
+    max30205_test_fixture_set_clock(0, cost_us);
+    res = max30205_budget_init(&gs_budget, 100000, 10.0f, cost_us * 2);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: budget init failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: one read takes %dus of bus time.\n", cost_us);
+    
+    /* burst test */
+    max30205_interface_debug_print("max30205: burst test.\n");
+    if ((a_max30205_budget_test_read(&wait_us) != 0) ||
+        (a_max30205_budget_test_read(&wait_us) != 0))
+    {
+        max30205_interface_debug_print("max30205: burst is throttled.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    transfers = max30205_test_fixture_get_transfers();
+    res = a_max30205_budget_test_read(&wait_us);
+    if ((res != 4) || (wait_us == 0))
+    {
+        max30205_interface_debug_print("max30205: read past the burst is not throttled.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (max30205_test_fixture_get_transfers() != transfers)
+    {
+        max30205_interface_debug_print("max30205: throttled read touches the bus.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: read past the burst waits %dus.\n", wait_us);
+    max30205_test_fixture_set_clock(max30205_test_fixture_timestamp_us() + wait_us, cost_us);
+    res = a_max30205_budget_test_read(&wait_us);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: read after the wait is throttled.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: read after the wait passes.\n");
+    
+    /* occupancy test */
+    max30205_interface_debug_print("max30205: occupancy test.\n");
+    (void)max30205_budget_get_report(&gs_budget, (float *)&actual, (float *)&budgeted, (uint32_t *)&throttled);
+    end_us = max30205_test_fixture_timestamp_us() + 1000000;
+    while (max30205_test_fixture_timestamp_us() < end_us)
+    {
+        res = a_max30205_budget_test_read(&wait_us);
+        if (res == 4)
+        {
+            max30205_test_fixture_set_clock(max30205_test_fixture_timestamp_us() + wait_us, cost_us);
+        }
+        else if (res != 0)
+        {
+            max30205_interface_debug_print("max30205: read failed.\n");
+            (void)max30205_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    res = max30205_budget_get_report(&gs_budget, (float *)&actual, (float *)&budgeted, (uint32_t *)&throttled);
+    if ((res != 0) || (actual > budgeted + 0.5f) || (actual < budgeted - 0.5f) || (throttled == 0))
+    {
+        max30205_interface_debug_print("max30205: occupancy is %.02f%% for a budget of %.02f%%.\n", actual, budgeted);
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: occupancy is %.02f%% for a budget of %.02f%%, %d reads throttled.\n",
+                                   actual, budgeted, throttled);
+    
+    /* stop continuous read */
+    res = max30205_stop_continuous_read(&gs_handle);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: stop continuous read failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* finished budget test */
+    max30205_interface_debug_print("max30205: finished budget test.\n");
+    (void)max30205_deinit(&gs_handle);
+    
+    return 0;
+}
@@ -0,0 +1,267 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_coalesce_test.c
+ * @brief     driver max30205 coalesce test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_max30205_coalesce_test.h"
+#include "driver_max30205_coalesce.h"
+#include "driver_max30205_test_fixture.h"
+
+static max30205_handle_t gs_handle;        /**< max30205 handle */
+static max30205_coalesce_t gs_coalesce;    /**< max30205 coalesce */
+
+/**
+ * @brief     call the irq handler like an os pin edge
+ * @param[in] edges edge number
+ * @note      none
+ */
+static void a_max30205_coalesce_test_edges(uint32_t edges)
+{
+    uint32_t i;
+    
+    for (i = 0; i < edges; i++)
+    {
+        (void)max30205_coalesce_irq_handler(&gs_coalesce);
+    }
+}
+
+/**
+ * @brief     check the fault queue of the chip
+ * @param[in] fault_queue expected fault queue
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_max30205_coalesce_test_queue(max30205_fault_queue_t fault_queue)
+{
+    uint8_t conf;
+    
+    if (max30205_test_fixture_get_conf(&gs_handle, (uint8_t *)&conf) != 0)
+    {
+        return 1;
+    }
+    
+    return (((conf >> 3) & 0x03) == fault_queue) ? 0 : 1;
+}
+
+/**
+ * @brief     coalesce test
+ * @param[in] addr iic device address
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the os pin edges come from calls of the irq handler and the time is simulated,
+ *            so only the chip is needed on the bus
+ */
+uint8_t max30205_coalesce_test(max30205_address_t addr)
+{
+    uint8_t res;
+    max30205_fault_queue_t fault_queue;
+    max30205_coalesce_event_t event;
+    
+    /* start coalesce test */
+    max30205_interface_debug_print("max30205: start coalesce test.\n");
+    res = max30205_test_fixture_init(&gs_handle, addr, MAX30205_FAULT_QUEUE_1);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* 100ms window and 8 edges start a storm */
+    res = max30205_coalesce_init(&gs_coalesce, &gs_handle, 100, 8);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: coalesce init failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = max30205_coalesce_set_storm_fault_queue(&gs_coalesce, 1, MAX30205_FAULT_QUEUE_6);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: set storm fault queue failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* merge test */
+    max30205_interface_debug_print("max30205: merge test.\n");
+    a_max30205_coalesce_test_edges(3);
+    res = max30205_coalesce_process(&gs_coalesce, 0, &event);
+    if ((res != 0) || (event.count != 3) || (event.storm != 0))
+    {
+        max30205_interface_debug_print("max30205: 3 edges are not merged into one event.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: 3 edges are merged, temperature is %.01fC.\n", event.s);
+    
+    /* rate limit test */
+    max30205_interface_debug_print("max30205: rate limit test.\n");
+    a_max30205_coalesce_test_edges(2);
+    res = max30205_coalesce_process(&gs_coalesce, 50, &event);
+    if ((res != 0) || (event.count != 0))
+    {
+        max30205_interface_debug_print("max30205: event inside the window is not held back.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = max30205_coalesce_process(&gs_coalesce, 100, &event);
+    if ((res != 0) || (event.count != 2))
+    {
+        max30205_interface_debug_print("max30205: held edges are not released after the window.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: 2 edges are held for one window.\n");
+    
+    /* storm test */
+    max30205_interface_debug_print("max30205: storm test.\n");
+    a_max30205_coalesce_test_edges(20);
+    res = max30205_coalesce_process(&gs_coalesce, 200, &event);
+    if ((res != 0) || (event.count != 20) || (event.storm != 1))
+    {
+        max30205_interface_debug_print("max30205: storm is not detected.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_max30205_coalesce_test_queue(MAX30205_FAULT_QUEUE_6) != 0)
+    {
+        max30205_interface_debug_print("max30205: storm fault queue is not written.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: storm raises the fault queue to 6.\n");
+    res = max30205_coalesce_process(&gs_coalesce, 300, &event);
+    if ((res != 0) || (event.count != 0) || (event.storm != 0))
+    {
+        max30205_interface_debug_print("max30205: storm does not end after a quiet window.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_max30205_coalesce_test_queue(MAX30205_FAULT_QUEUE_1) != 0)
+    {
+        max30205_interface_debug_print("max30205: fault queue is not restored.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: quiet window restores the fault queue to 1.\n");
+    
+    /* failed write test */
+    max30205_interface_debug_print("max30205: failed write test.\n");
+    a_max30205_coalesce_test_edges(20);
+    max30205_test_fixture_set_fail(0, 1);
+    res = max30205_coalesce_process(&gs_coalesce, 400, &event);
+    max30205_test_fixture_set_fail(0, 0);
+    if ((res != 1) || (event.count != 0))
+    {
+        max30205_interface_debug_print("max30205: failed storm write is not reported.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = max30205_get_fault_queue(&gs_handle, &fault_queue);
+    if ((res != 0) || (fault_queue != MAX30205_FAULT_QUEUE_1))
+    {
+        max30205_interface_debug_print("max30205: mirror changed after a failed write.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = max30205_coalesce_process(&gs_coalesce, 400, &event);
+    if ((res != 0) || (event.count != 20) || (event.storm != 1))
+    {
+        max30205_interface_debug_print("max30205: pending edges are not retried.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = max30205_coalesce_process(&gs_coalesce, 500, &event);
+    if ((res != 0) || (event.storm != 0))
+    {
+        max30205_interface_debug_print("max30205: storm does not end after a quiet window.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: failed write keeps the edges pending and is retried.\n");
+    
+    /* failed read test */
+    max30205_interface_debug_print("max30205: failed read test.\n");
+    a_max30205_coalesce_test_edges(3);
+    max30205_test_fixture_set_fail(1, 0);
+    res = max30205_coalesce_process(&gs_coalesce, 600, &event);
+    max30205_test_fixture_set_fail(0, 0);
+    if ((res != 1) || (event.count != 0))
+    {
+        max30205_interface_debug_print("max30205: failed read is not reported.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = max30205_coalesce_process(&gs_coalesce, 600, &event);
+    if ((res != 0) || (event.count != 3))
+    {
+        max30205_interface_debug_print("max30205: edges of a failed read are lost.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: failed read keeps the edges pending and is retried.\n");
+    
+    /* stop continuous read */
+    res = max30205_stop_continuous_read(&gs_handle);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: stop continuous read failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* finished coalesce test */
+    max30205_interface_debug_print("max30205: finished coalesce test.\n");
+    (void)max30205_deinit(&gs_handle);
+    
+    return 0;
+}
@@ -0,0 +1,332 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_health_test.c
+ * @brief     driver max30205 health test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_max30205_health_test.h"
+#include "driver_max30205_health.h"
+#include "driver_max30205_test_fixture.h"
+
+static max30205_handle_t gs_handle;        /**< max30205 handle */
+static max30205_health_t gs_health;        /**< max30205 health */
+
+/**
+ * @brief     run sweeps and check the state after the last one
+ * @param[in] timestamp_ms time of the first sweep
+ * @param[in] times sweep times
+ * @param[in] state expected health state
+ * @param[in] backoff_ms expected probe interval
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      the sweeps are 1ms apart
+ */
+static uint8_t a_max30205_health_test_sweep(uint32_t timestamp_ms, uint32_t times,
+                                            max30205_health_state_t state, uint32_t backoff_ms)
+{
+    uint32_t i;
+    uint32_t trips;
+    uint32_t backoff;
+    max30205_health_state_t s;
+    
+    for (i = 0; i < times; i++)
+    {
+        if (max30205_health_sweep(&gs_health, timestamp_ms + i) != 0)
+        {
+            return 1;
+        }
+    }
+    if (max30205_health_get_state(&gs_health, 0, &s, &trips, &backoff) != 0)
+    {
+        return 1;
+    }
+    if ((s != state) || (backoff != backoff_ms))
+    {
+        max30205_interface_debug_print("max30205: state is %d, backoff is %dms.\n", s, backoff);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     health test
+ * @param[in] addr iic device address
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      bus failures are injected in the linked iic functions and the time is simulated,
+ *            so only the chip is needed on the bus
+ */
+uint8_t max30205_health_test(max30205_address_t addr)
+{
+    uint8_t res;
+    uint8_t index;
+    uint8_t conf;
+    uint32_t transfers;
+    uint32_t trips;
+    uint32_t backoff;
+    int16_t low_threshold, high_threshold;
+    int16_t threshold;
+    int16_t raw;
+    float s;
+    max30205_health_state_t state;
+    
+    /* start health test */
+    max30205_interface_debug_print("max30205: start health test.\n");
+    res = max30205_test_fixture_init(&gs_handle, addr, MAX30205_FAULT_QUEUE_4);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* convert the thresholds 35.0 and 39.0 */
+    res = max30205_convert_to_register(&gs_handle, 35.0f, (int16_t *)&low_threshold);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: convert to register failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = max30205_convert_to_register(&gs_handle, 39.0f, (int16_t *)&high_threshold);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: convert to register failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* 3 errors open the circuit, probes back off from 100ms to 400ms */
+    res = max30205_health_init(&gs_health, 3, 100, 400);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: health init failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = max30205_health_add(&gs_health, &gs_handle, low_threshold, high_threshold, &index);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: health add failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* recover test */
+    max30205_interface_debug_print("max30205: recover test.\n");
+    if (a_max30205_health_test_sweep(0, 1, MAX30205_HEALTH_STATE_DEGRADED, 100) != 0)
+    {
+        max30205_interface_debug_print("max30205: first probe does not close the circuit.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_max30205_health_test_sweep(1, MAX30205_HEALTH_RECOVER_READS, MAX30205_HEALTH_STATE_HEALTHY, 100) != 0)
+    {
+        max30205_interface_debug_print("max30205: good reads do not make the sensor healthy.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = max30205_health_get_sample(&gs_health, index, (int16_t *)&raw, (float *)&s);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: get sample failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: sensor is healthy, temperature is %.01fC.\n", s);
+    
+    /* trip test */
+    max30205_interface_debug_print("max30205: trip test.\n");
+    max30205_test_fixture_set_fail(1, 1);
+    if (a_max30205_health_test_sweep(1000, 2, MAX30205_HEALTH_STATE_DEGRADED, 100) != 0)
+    {
+        max30205_interface_debug_print("max30205: failed reads do not degrade the sensor.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_max30205_health_test_sweep(1002, 1, MAX30205_HEALTH_STATE_FAILED, 100) != 0)
+    {
+        max30205_interface_debug_print("max30205: 3 failed reads do not open the circuit.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = max30205_health_get_state(&gs_health, index, &state, &trips, &backoff);
+    if ((res != 0) || (trips != 1))
+    {
+        max30205_interface_debug_print("max30205: trip is not counted.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: 3 failed reads open the circuit.\n");
+    
+    /* backoff test */
+    max30205_interface_debug_print("max30205: backoff test.\n");
+    transfers = max30205_test_fixture_get_transfers();
+    if (a_max30205_health_test_sweep(1003, 99, MAX30205_HEALTH_STATE_FAILED, 100) != 0)
+    {
+        max30205_interface_debug_print("max30205: state changed before the probe.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (max30205_test_fixture_get_transfers() != transfers)
+    {
+        max30205_interface_debug_print("max30205: failed sensor is touched before the probe.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_max30205_health_test_sweep(1102, 1, MAX30205_HEALTH_STATE_FAILED, 200) != 0)
+    {
+        max30205_interface_debug_print("max30205: failed probe does not double the backoff.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (max30205_test_fixture_get_transfers() != transfers + 1)
+    {
+        max30205_interface_debug_print("max30205: probe of a missing sensor is not one read.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    transfers = max30205_test_fixture_get_transfers();
+    if (a_max30205_health_test_sweep(1103, 199, MAX30205_HEALTH_STATE_FAILED, 200) != 0)
+    {
+        max30205_interface_debug_print("max30205: state changed before the probe.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (max30205_test_fixture_get_transfers() != transfers)
+    {
+        max30205_interface_debug_print("max30205: failed sensor is touched before the probe.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_max30205_health_test_sweep(1302, 1, MAX30205_HEALTH_STATE_FAILED, 400) != 0)
+    {
+        max30205_interface_debug_print("max30205: failed probe does not double the backoff.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_max30205_health_test_sweep(1702, 1, MAX30205_HEALTH_STATE_FAILED, 400) != 0)
+    {
+        max30205_interface_debug_print("max30205: backoff is not clamped.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: silent probes back off from 100ms to 400ms.\n");
+    
+    /* replug test */
+    max30205_interface_debug_print("max30205: replug test.\n");
+    max30205_test_fixture_set_fail(0, 0);
+    if ((max30205_test_fixture_reset(&gs_handle, 0x01) != 0) || (max30205_test_fixture_reset(&gs_handle, 0x02) != 0) ||
+        (max30205_test_fixture_reset(&gs_handle, 0x03) != 0))
+    {
+        max30205_interface_debug_print("max30205: set reg failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_max30205_health_test_sweep(2102, 1, MAX30205_HEALTH_STATE_DEGRADED, 100) != 0)
+    {
+        max30205_interface_debug_print("max30205: probe does not close the circuit.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = max30205_test_fixture_get_conf(&gs_handle, (uint8_t *)&conf);
+    if ((res != 0) || (((conf >> 3) & 0x03) != MAX30205_FAULT_QUEUE_4))
+    {
+        max30205_interface_debug_print("max30205: conf is not restored.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = max30205_test_fixture_get_threshold(&gs_handle, 0x02, (int16_t *)&threshold);
+    if ((res != 0) || (threshold != low_threshold))
+    {
+        max30205_interface_debug_print("max30205: low threshold is not restored.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = max30205_test_fixture_get_threshold(&gs_handle, 0x03, (int16_t *)&threshold);
+    if ((res != 0) || (threshold != high_threshold))
+    {
+        max30205_interface_debug_print("max30205: high threshold is not restored.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_max30205_health_test_sweep(2103, MAX30205_HEALTH_RECOVER_READS, MAX30205_HEALTH_STATE_HEALTHY, 100) != 0)
+    {
+        max30205_interface_debug_print("max30205: good reads do not make the sensor healthy.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: replugged sensor gets its configuration back.\n");
+    
+    /* stop continuous read */
+    res = max30205_stop_continuous_read(&gs_handle);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: stop continuous read failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* finished health test */
+    max30205_interface_debug_print("max30205: finished health test.\n");
+    (void)max30205_deinit(&gs_handle);
+    
+    return 0;
+}
@@ -36,8 +36,63 @@
  */
 
 #include "driver_max30205_read_test.h"
+#include "driver_max30205_periodic.h"
 
-static max30205_handle_t gs_handle;        /**< max30205 handle */
+static max30205_handle_t gs_handle;          /**< max30205 handle */
+static max30205_periodic_t gs_periodic;      /**< max30205 periodic sampler */
+
+/**
+ * @brief     read once per second on absolute deadlines
+ * @param[in] *read pointer to a read function
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      none
+ */
+static uint8_t a_max30205_read_test_loop(uint8_t (*read)(max30205_handle_t *handle, int16_t *raw, float *s),
+                                         uint32_t times)
+{
+    uint8_t res;
+    uint32_t i;
+    uint64_t timestamp_us;
+    int16_t raw;
+    float s;
+    max30205_periodic_stats_t stats;
+    
+    /* periodic sampler init */
+    DRIVER_MAX30205_PERIODIC_LINK_INIT(&gs_periodic, max30205_periodic_t);
+    DRIVER_MAX30205_PERIODIC_LINK_SLEEP_UNTIL_US(&gs_periodic, max30205_interface_sleep_until_us);
+    res = max30205_periodic_init(&gs_periodic, &gs_handle, read, 1000000);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: periodic init failed.\n");
+        
+        return 1;
+    }
+    
+    for (i = 0; i < times; i++)
+    {
+        /* wait for the next deadline and read data */
+        res = max30205_periodic_read(&gs_periodic, (int16_t *)&raw, (float *)&s, &timestamp_us);
+        if (res != 0)
+        {
+            max30205_interface_debug_print("max30205: read failed.\n");
+            
+            return 1;
+        }
+        max30205_interface_debug_print("max30205: temperature: %.01fC.\n", s);
+    }
+    
+    /* output the statistics */
+    (void)max30205_periodic_get_stats(&gs_periodic, &stats);
+    max30205_interface_debug_print("max30205: %d samples, %d overruns, %d skipped.\n",
+                                   stats.samples, stats.overruns, stats.skipped);
+    max30205_interface_debug_print("max30205: jitter min %dus max %dus mean %0.1fus.\n",
+                                   stats.jitter_min_us, stats.jitter_max_us, stats.jitter_mean_us);
+    
+    return 0;
+}
 
 /**
  * @brief     read test
@@ -51,10 +106,7 @@ static max30205_handle_t gs_handle;        /**< max30205 handle */
 uint8_t max30205_read_test(max30205_address_t addr, uint32_t times)
 {
     uint8_t res;
-    uint32_t i;
     int16_t low_threshold, high_threshold;
-    int16_t raw;
-    float s;
     max30205_info_t info;
     
     /* link interface function */
@@ -65,6 +117,7 @@ uint8_t max30205_read_test(max30205_address_t addr, uint32_t times)
     DRIVER_MAX30205_LINK_IIC_WRITE(&gs_handle, max30205_interface_iic_write);
     DRIVER_MAX30205_LINK_DELAY_MS(&gs_handle, max30205_interface_delay_ms);
     DRIVER_MAX30205_LINK_DEBUG_PRINT(&gs_handle, max30205_interface_debug_print);
+    DRIVER_MAX30205_LINK_TIMESTAMP_US(&gs_handle, max30205_interface_timestamp_us);
     
     /* get information */
     res = max30205_info(&info);
@@ -197,19 +250,12 @@ uint8_t max30205_read_test(max30205_address_t addr, uint32_t times)
         
         return 1;
     }
-    for (i = 0; i < times; i++)
+    res = a_max30205_read_test_loop(max30205_single_read, times);
+    if (res != 0)
     {
-        /* read data */
-        res = max30205_single_read(&gs_handle, (int16_t *)&raw, (float *)&s);
-        if (res != 0)
-        {
-            max30205_interface_debug_print("max30205: read failed.\n");
-            (void)max30205_deinit(&gs_handle);
-            
-            return 1;
-        }
-        max30205_interface_debug_print("max30205: temperature: %.01fC.\n", s);
-        max30205_interface_delay_ms(1000);
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
     }
     
     /* set extended format */
@@ -222,36 +268,22 @@ uint8_t max30205_read_test(max30205_address_t addr, uint32_t times)
         
         return 1;
     }
-    for (i = 0; i < times; i++)
+    res = a_max30205_read_test_loop(max30205_single_read, times);
+    if (res != 0)
     {
-        /* read data */
-        res = max30205_single_read(&gs_handle, (int16_t *)&raw, (float *)&s);
-        if (res != 0)
-        {
-            max30205_interface_debug_print("max30205: read failed.\n");
-            (void)max30205_deinit(&gs_handle);
-            
-            return 1;
-        }
-        max30205_interface_debug_print("max30205: temperature: %.01fC.\n", s);
-        max30205_interface_delay_ms(1000);
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
     }
     
     /* single read test */
     max30205_interface_debug_print("max30205: single read test.\n");
-    for (i = 0; i < times; i++)
+    res = a_max30205_read_test_loop(max30205_single_read, times);
+    if (res != 0)
     {
-        /* read data */
-        res = max30205_single_read(&gs_handle, (int16_t *)&raw, (float *)&s);
-        if (res != 0)
-        {
-            max30205_interface_debug_print("max30205: read failed.\n");
-            (void)max30205_deinit(&gs_handle);
-            
-            return 1;
-        }
-        max30205_interface_debug_print("max30205: temperature: %.01fC.\n", s);
-        max30205_interface_delay_ms(1000);
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
     }
     
     /* continuous read test */
@@ -265,19 +297,12 @@ uint8_t max30205_read_test(max30205_address_t addr, uint32_t times)
         return 1;
     }
     max30205_interface_delay_ms(1000);
-    for (i = 0; i < times; i++)
+    res = a_max30205_read_test_loop(max30205_continuous_read, times);
+    if (res != 0)
     {
-        /* read data */
-        res = max30205_continuous_read(&gs_handle, (int16_t *)&raw, (float *)&s);
-        if (res != 0)
-        {
-            max30205_interface_debug_print("max30205: read failed.\n");
-            (void)max30205_deinit(&gs_handle);
-            
-            return 1;
-        }
-        max30205_interface_debug_print("max30205: temperature: %.01fC.\n", s);
-        max30205_interface_delay_ms(1000);
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
     }
     res = max30205_stop_continuous_read(&gs_handle);
     if (res != 0)
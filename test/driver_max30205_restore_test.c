@@ -0,0 +1,270 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_restore_test.c
+ * @brief     driver max30205 restore test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_max30205_restore_test.h"
+#include "driver_max30205_restore.h"
+#include "driver_max30205_test_fixture.h"
+
+static max30205_handle_t gs_handle;        /**< max30205 handle */
+static max30205_restore_t gs_restore;      /**< max30205 restore */
+
+/**
+ * @brief     read samples
+ * @param[in] index sensor index
+ * @param[in] times read times
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      none
+ */
+static uint8_t a_max30205_restore_test_read(uint8_t index, uint32_t times)
+{
+    uint32_t i;
+    int16_t raw;
+    float s;
+    
+    for (i = 0; i < times; i++)
+    {
+        if (max30205_restore_read(&gs_restore, index, (int16_t *)&raw, (float *)&s) != 0)
+        {
+            max30205_interface_debug_print("max30205: read failed.\n");
+            
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     check the registers of the chip
+ * @param[in] low_threshold expected hysteresis register
+ * @param[in] high_threshold expected overtemperature register
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      the conf register must hold fault queue 4 and continuous conversions
+ */
+static uint8_t a_max30205_restore_test_check(int16_t low_threshold, int16_t high_threshold)
+{
+    uint8_t conf;
+    int16_t threshold;
+    
+    if (max30205_test_fixture_get_conf(&gs_handle, (uint8_t *)&conf) != 0)
+    {
+        return 1;
+    }
+    if ((((conf >> 3) & 0x03) != MAX30205_FAULT_QUEUE_4) || ((conf & 0x01) != 0))
+    {
+        max30205_interface_debug_print("max30205: conf is 0x%02X.\n", conf);
+        
+        return 1;
+    }
+    if ((max30205_test_fixture_get_threshold(&gs_handle, 0x02, (int16_t *)&threshold) != 0) ||
+        (threshold != low_threshold))
+    {
+        max30205_interface_debug_print("max30205: low threshold is wrong.\n");
+        
+        return 1;
+    }
+    if ((max30205_test_fixture_get_threshold(&gs_handle, 0x03, (int16_t *)&threshold) != 0) ||
+        (threshold != high_threshold))
+    {
+        max30205_interface_debug_print("max30205: high threshold is wrong.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     restore test
+ * @param[in] addr iic device address
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      a chip reset is simulated by writing the power-on values of the registers
+ */
+uint8_t max30205_restore_test(max30205_address_t addr)
+{
+    uint8_t res;
+    uint8_t index;
+    uint32_t reads;
+    uint32_t checks;
+    uint32_t resets;
+    int16_t low_threshold, high_threshold;
+    
+    /* start restore test */
+    max30205_interface_debug_print("max30205: start restore test.\n");
+    res = max30205_test_fixture_init(&gs_handle, addr, MAX30205_FAULT_QUEUE_4);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* convert the thresholds 35.0 and 39.0 */
+    res = max30205_convert_to_register(&gs_handle, 35.0f, (int16_t *)&low_threshold);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: convert to register failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = max30205_convert_to_register(&gs_handle, 39.0f, (int16_t *)&high_threshold);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: convert to register failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* one register check every 2 reads */
+    res = max30205_restore_init(&gs_restore, 2);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: restore init failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = max30205_restore_add(&gs_restore, &gs_handle, 0, low_threshold, high_threshold, &index);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: restore add failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_max30205_restore_test_check(low_threshold, high_threshold) != 0)
+    {
+        max30205_interface_debug_print("max30205: configuration is not applied.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* steady test */
+    max30205_interface_debug_print("max30205: steady test.\n");
+    if (a_max30205_restore_test_read(index, 12) != 0)
+    {
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = max30205_restore_get_stats(&gs_restore, &reads, &checks, &resets);
+    if ((res != 0) || (reads != 12) || (checks != 6) || (resets != 0))
+    {
+        max30205_interface_debug_print("max30205: %d reads run %d checks and find %d resets.\n", reads, checks, resets);
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: 12 reads run 6 checks and find no reset.\n");
+    
+    /* full reset test */
+    max30205_interface_debug_print("max30205: full reset test.\n");
+    if ((max30205_test_fixture_reset(&gs_handle, 0x01) != 0) || (max30205_test_fixture_reset(&gs_handle, 0x02) != 0) ||
+        (max30205_test_fixture_reset(&gs_handle, 0x03) != 0))
+    {
+        max30205_interface_debug_print("max30205: set reg failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_max30205_restore_test_read(index, 6) != 0)
+    {
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = max30205_restore_get_stats(&gs_restore, &reads, &checks, &resets);
+    if ((res != 0) || (resets != 1))
+    {
+        max30205_interface_debug_print("max30205: full reset is found %d times.\n", resets);
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_max30205_restore_test_check(low_threshold, high_threshold) != 0)
+    {
+        max30205_interface_debug_print("max30205: configuration is not applied again.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: full reset is found and the configuration is applied again.\n");
+    
+    /* partial reset test */
+    max30205_interface_debug_print("max30205: partial reset test.\n");
+    if (max30205_test_fixture_reset(&gs_handle, 0x03) != 0)
+    {
+        max30205_interface_debug_print("max30205: set reg failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_max30205_restore_test_read(index, 6) != 0)
+    {
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = max30205_restore_get_stats(&gs_restore, &reads, &checks, &resets);
+    if ((res != 0) || (resets != 2))
+    {
+        max30205_interface_debug_print("max30205: partial reset is not found.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_max30205_restore_test_check(low_threshold, high_threshold) != 0)
+    {
+        max30205_interface_debug_print("max30205: configuration is not applied again.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: lost overtemperature register is found and written again.\n");
+    
+    /* finished restore test */
+    max30205_interface_debug_print("max30205: finished restore test.\n");
+    (void)max30205_deinit(&gs_handle);
+    
+    return 0;
+}
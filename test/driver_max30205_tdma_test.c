@@ -0,0 +1,245 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_tdma_test.c
+ * @brief     driver max30205 tdma test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_max30205_tdma_test.h"
+#include "driver_max30205_tdma.h"
+#include "driver_max30205_test_fixture.h"
+
+static max30205_handle_t gs_handle;        /**< max30205 handle */
+static max30205_tdma_t gs_tdma;            /**< max30205 tdma */
+
+/**
+ * @brief     run the scheduler and check the result
+ * @param[in] now_us simulated time of the run
+ * @param[in] cost_us simulated time of the read
+ * @param[in] res expected status code
+ * @param[in] index expected slot index or wait time when res is 4
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_max30205_tdma_test_run(uint64_t now_us, uint32_t cost_us, uint8_t res, uint32_t index)
+{
+    uint8_t r;
+    uint8_t i;
+    uint32_t wait_us;
+    
+    max30205_test_fixture_set_clock(now_us, cost_us);
+    r = max30205_tdma_run(&gs_tdma, &i, &wait_us);
+    if (r != res)
+    {
+        max30205_interface_debug_print("max30205: run returned %d.\n", r);
+        
+        return 1;
+    }
+    if ((res == 4) && (wait_us != index))
+    {
+        max30205_interface_debug_print("max30205: wait is %dus.\n", wait_us);
+        
+        return 1;
+    }
+    if ((res == 0) && (i != index))
+    {
+        max30205_interface_debug_print("max30205: slot %d ran.\n", i);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     tdma test
+ * @param[in] addr iic device address
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the scheduler runs on a simulated clock that every read advances by a set cost,
+ *            so the slot timing does not depend on the host
+ */
+uint8_t max30205_tdma_test(max30205_address_t addr)
+{
+    uint8_t res;
+    uint32_t staleness_us;
+    float utilization;
+    
+    /* start tdma test */
+    max30205_interface_debug_print("max30205: start tdma test.\n");
+    res = max30205_test_fixture_init(&gs_handle, addr, MAX30205_FAULT_QUEUE_1);
+    if (res != 0)
+    {
+        return 1;
+    }
+    DRIVER_MAX30205_TDMA_LINK_INIT(&gs_tdma, max30205_tdma_t);
+    DRIVER_MAX30205_TDMA_LINK_TIMESTAMP_US(&gs_tdma, max30205_test_fixture_timestamp_us);
+    
+    /* 10ms period, 500us guard and two slots on the same chip */
+    res = max30205_tdma_init(&gs_tdma, 10000, 500);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: tdma init failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if ((max30205_tdma_add(&gs_tdma, &gs_handle) != 0) || (max30205_tdma_add(&gs_tdma, &gs_handle) != 0))
+    {
+        max30205_interface_debug_print("max30205: tdma add failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* plan test */
+    max30205_interface_debug_print("max30205: plan test.\n");
+    max30205_test_fixture_set_clock(0, 1000);
+    res = max30205_tdma_calibrate(&gs_tdma, 3);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: tdma calibrate failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = max30205_tdma_plan(&gs_tdma);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: tdma plan failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if ((gs_tdma.slot[0].offset_us != 0) || (gs_tdma.slot[0].window_us != 5000) ||
+        (gs_tdma.slot[1].offset_us != 5000) || (gs_tdma.slot[1].window_us != 5000))
+    {
+        max30205_interface_debug_print("max30205: slots are not spread evenly.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = max30205_tdma_get_bound(&gs_tdma, (uint32_t *)&staleness_us, (float *)&utilization);
+    if ((res != 0) || (staleness_us != 15000) || (utilization < 19.9f) || (utilization > 20.1f))
+    {
+        max30205_interface_debug_print("max30205: bound is wrong.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: staleness is %dus, utilization is %.01f%%.\n", staleness_us, utilization);
+    
+    /* schedule test */
+    max30205_interface_debug_print("max30205: schedule test.\n");
+    if ((a_max30205_tdma_test_run(0, 1000, 0, 0) != 0) || (a_max30205_tdma_test_run(1000, 1000, 4, 4000) != 0) ||
+        (a_max30205_tdma_test_run(5000, 1000, 0, 1) != 0) || (a_max30205_tdma_test_run(6000, 1000, 4, 4000) != 0))
+    {
+        max30205_interface_debug_print("max30205: slots do not run at their offsets.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if ((gs_tdma.slot[0].overrun != 0) || (gs_tdma.slot[1].overrun != 0))
+    {
+        max30205_interface_debug_print("max30205: slot in time counts an overrun.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: slots run at their offsets.\n");
+    
+    /* overrun test */
+    max30205_interface_debug_print("max30205: overrun test.\n");
+    if (a_max30205_tdma_test_run(10000, 6000, 0, 0) != 0)
+    {
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_max30205_tdma_test_run(16000, 1000, 0, 1) != 0)
+    {
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if ((gs_tdma.slot[0].overrun != 1) || (gs_tdma.slot[1].overrun != 0) || (gs_tdma.slot[1].last_late_us != 1000))
+    {
+        max30205_interface_debug_print("max30205: overrun is not counted on the slot that ran long.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: long read counts an overrun and the next slot runs late.\n");
+    
+    /* skip test */
+    max30205_interface_debug_print("max30205: skip test.\n");
+    if ((a_max30205_tdma_test_run(42000, 1000, 0, 0) != 0) || (a_max30205_tdma_test_run(43000, 1000, 4, 2000) != 0))
+    {
+        max30205_interface_debug_print("max30205: missed periods are not skipped.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if ((gs_tdma.slot[0].overrun != 2) || (gs_tdma.slot[0].last_late_us != 2000))
+    {
+        max30205_interface_debug_print("max30205: missed periods are not counted.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_max30205_tdma_test_run(45000, 1000, 0, 1) != 0)
+    {
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max30205_interface_debug_print("max30205: missed periods are skipped and the schedule resumes.\n");
+    
+    /* stop continuous read */
+    res = max30205_stop_continuous_read(&gs_handle);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: stop continuous read failed.\n");
+        (void)max30205_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* finished tdma test */
+    max30205_interface_debug_print("max30205: finished tdma test.\n");
+    (void)max30205_deinit(&gs_handle);
+    
+    return 0;
+}
@@ -0,0 +1,272 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_test_fixture.c
+ * @brief     driver max30205 test fixture source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_max30205_test_fixture.h"
+
+static uint8_t gs_fail_read;          /**< injected read failure flag */
+static uint8_t gs_fail_write;         /**< injected write failure flag */
+static uint32_t gs_transfers;         /**< transfer counter */
+static uint64_t gs_now_us;            /**< simulated time */
+static uint32_t gs_read_cost_us;      /**< simulated read time */
+
+/**
+ * @brief      fixture iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_max30205_test_fixture_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    gs_transfers++;
+    gs_now_us += gs_read_cost_us;
+    if (gs_fail_read != 0)
+    {
+        return 1;
+    }
+    
+    return max30205_interface_iic_read(addr, reg, buf, len);
+}
+
+/**
+ * @brief     fixture iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_max30205_test_fixture_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    gs_transfers++;
+    if (gs_fail_write != 0)
+    {
+        return 1;
+    }
+    
+    return max30205_interface_iic_write(addr, reg, buf, len);
+}
+
+/**
+ * @brief     link the fixture bus and start continuous conversions
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] addr iic device address
+ * @param[in] fault_queue fault queue
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the iic read and write of the handle go through the fixture, which counts the
+ *            transfers, injects failures and advances the simulated clock, the injected failures,
+ *            the counter and the clock are cleared
+ */
+uint8_t max30205_test_fixture_init(max30205_handle_t *handle, max30205_address_t addr, max30205_fault_queue_t fault_queue)
+{
+    uint8_t res;
+    
+    /* link interface function */
+    DRIVER_MAX30205_LINK_INIT(handle, max30205_handle_t);
+    DRIVER_MAX30205_LINK_IIC_INIT(handle, max30205_interface_iic_init);
+    DRIVER_MAX30205_LINK_IIC_DEINIT(handle, max30205_interface_iic_deinit);
+    DRIVER_MAX30205_LINK_IIC_READ(handle, a_max30205_test_fixture_iic_read);
+    DRIVER_MAX30205_LINK_IIC_WRITE(handle, a_max30205_test_fixture_iic_write);
+    DRIVER_MAX30205_LINK_DELAY_MS(handle, max30205_interface_delay_ms);
+    DRIVER_MAX30205_LINK_DEBUG_PRINT(handle, max30205_interface_debug_print);
+    DRIVER_MAX30205_LINK_TIMESTAMP_US(handle, max30205_interface_timestamp_us);
+    gs_fail_read = 0;
+    gs_fail_write = 0;
+    gs_transfers = 0;
+    gs_now_us = 0;
+    gs_read_cost_us = 0;
+    
+    /* set addr pin */
+    res = max30205_set_addr_pin(handle, addr);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: set addr pin failed.\n");
+       
+        return 1;
+    }
+    
+    /* max30205 init */
+    res = max30205_init(handle);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: init failed.\n");
+       
+        return 1;
+    }
+    
+    /* set fault queue */
+    res = max30205_set_fault_queue(handle, fault_queue);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: set fault queue failed.\n");
+        (void)max30205_deinit(handle);
+        
+        return 1;
+    }
+    
+    /* start continuous read */
+    res = max30205_start_continuous_read(handle);
+    if (res != 0)
+    {
+        max30205_interface_debug_print("max30205: start continuous read failed.\n");
+        (void)max30205_deinit(handle);
+        
+        return 1;
+    }
+    max30205_interface_delay_ms(100);
+    
+    return 0;
+}
+
+/**
+ * @brief     inject bus failures
+ * @param[in] read 1 to fail every iic read
+ * @param[in] write 1 to fail every iic write
+ * @note      a failed transfer is still counted
+ */
+void max30205_test_fixture_set_fail(uint8_t read, uint8_t write)
+{
+    gs_fail_read = read;
+    gs_fail_write = write;
+}
+
+/**
+ * @brief  get the transfer counter
+ * @return iic transfers since the fixture was inited
+ * @note   none
+ */
+uint32_t max30205_test_fixture_get_transfers(void)
+{
+    return gs_transfers;
+}
+
+/**
+ * @brief     set the simulated clock
+ * @param[in] now_us simulated time
+ * @param[in] read_cost_us simulated time every iic read takes
+ * @note      none
+ */
+void max30205_test_fixture_set_clock(uint64_t now_us, uint32_t read_cost_us)
+{
+    gs_now_us = now_us;
+    gs_read_cost_us = read_cost_us;
+}
+
+/**
+ * @brief  get the simulated time
+ * @return simulated time in us
+ * @note   link it as the timestamp_us of a module to run the module on the simulated clock
+ */
+uint64_t max30205_test_fixture_timestamp_us(void)
+{
+    return gs_now_us;
+}
+
+/**
+ * @brief      read the conf register of the chip
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[out] *conf pointer to a conf buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the chip is read, not the register mirror of the handle
+ */
+uint8_t max30205_test_fixture_get_conf(max30205_handle_t *handle, uint8_t *conf)
+{
+    if (max30205_get_reg(handle, 0x01, conf, 1) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      read a threshold register of the chip
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[in]  reg 0x02 for the hysteresis register, 0x03 for the overtemperature register
+ * @param[out] *threshold pointer to a threshold buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t max30205_test_fixture_get_threshold(max30205_handle_t *handle, uint8_t reg, int16_t *threshold)
+{
+    uint8_t buf[2];
+    
+    if (max30205_get_reg(handle, reg, (uint8_t *)buf, 2) != 0)
+    {
+        return 1;
+    }
+    *threshold = (int16_t)(((uint16_t)buf[0]) << 8 | buf[1]);
+    
+    return 0;
+}
+
+/**
+ * @brief     write the power-on value of a register like a chip reset
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] reg 0x01, 0x02 or 0x03
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t max30205_test_fixture_reset(max30205_handle_t *handle, uint8_t reg)
+{
+    uint8_t buf[2];
+    
+    if (reg == 0x01)
+    {
+        buf[0] = 0x00;
+        
+        return (max30205_set_reg(handle, reg, (uint8_t *)buf, 1) != 0) ? 1 : 0;
+    }
+    buf[0] = (reg == 0x02) ? 0x4B : 0x50;
+    buf[1] = 0x00;
+    
+    return (max30205_set_reg(handle, reg, (uint8_t *)buf, 2) != 0) ? 1 : 0;
+}
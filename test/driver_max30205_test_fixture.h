@@ -0,0 +1,137 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_max30205_test_fixture.h
+ * @brief     driver max30205 test fixture header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MAX30205_TEST_FIXTURE_H
+#define DRIVER_MAX30205_TEST_FIXTURE_H
+
+#include "driver_max30205_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup max30205_test_driver
+ * @{
+ */
+
+/**
+ * @brief     link the fixture bus and start continuous conversions
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] addr iic device address
+ * @param[in] fault_queue fault queue
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the iic read and write of the handle go through the fixture, which counts the
+ *            transfers, injects failures and advances the simulated clock, the injected failures,
+ *            the counter and the clock are cleared
+ */
+uint8_t max30205_test_fixture_init(max30205_handle_t *handle, max30205_address_t addr, max30205_fault_queue_t fault_queue);
+
+/**
+ * @brief     inject bus failures
+ * @param[in] read 1 to fail every iic read
+ * @param[in] write 1 to fail every iic write
+ * @note      a failed transfer is still counted
+ */
+void max30205_test_fixture_set_fail(uint8_t read, uint8_t write);
+
+/**
+ * @brief  get the transfer counter
+ * @return iic transfers since the fixture was inited
+ * @note   none
+ */
+uint32_t max30205_test_fixture_get_transfers(void);
+
+/**
+ * @brief     set the simulated clock
+ * @param[in] now_us simulated time
+ * @param[in] read_cost_us simulated time every iic read takes
+ * @note      none
+ */
+void max30205_test_fixture_set_clock(uint64_t now_us, uint32_t read_cost_us);
+
+/**
+ * @brief  get the simulated time
+ * @return simulated time in us
+ * @note   link it as the timestamp_us of a module to run the module on the simulated clock
+ */
+uint64_t max30205_test_fixture_timestamp_us(void);
+
+/**
+ * @brief      read the conf register of the chip
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[out] *conf pointer to a conf buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the chip is read, not the register mirror of the handle
+ */
+uint8_t max30205_test_fixture_get_conf(max30205_handle_t *handle, uint8_t *conf);
+
+/**
+ * @brief      read a threshold register of the chip
+ * @param[in]  *handle pointer to a max30205 handle structure
+ * @param[in]  reg 0x02 for the hysteresis register, 0x03 for the overtemperature register
+ * @param[out] *threshold pointer to a threshold buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t max30205_test_fixture_get_threshold(max30205_handle_t *handle, uint8_t reg, int16_t *threshold);
+
+/**
+ * @brief     write the power-on value of a register like a chip reset
+ * @param[in] *handle pointer to a max30205 handle structure
+ * @param[in] reg 0x01, 0x02 or 0x03
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t max30205_test_fixture_reset(max30205_handle_t *handle, uint8_t reg);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif